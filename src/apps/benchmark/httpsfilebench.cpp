@@ -0,0 +1,229 @@
+/*
+ * snode.c - a slim toolkit for network communication
+ * Copyright (C) 2020, 2021, 2022 Volker Christian <me@vchrist.at>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h" // just for this example app
+#include "core/EventLoop.h"
+#include "core/SNodeC.h"
+#include "express/tls/in/WebApp.h"
+#include "log/Logger.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <arpa/inet.h>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <netinet/in.h>
+#include <openssl/ssl.h>
+#include <string>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+// HTTPS static file serving throughput benchmark for kernel TLS offload.
+// A client thread downloads the same file repeatedly over one keep-alive connection from an express::tls::in::WebApp.
+// Run it once with and once without kTLS and compare throughput and cpu time:
+//
+// Usage: httpsfilebench [file-MiB [requests]] [httpsfilebench tls --ktls]
+
+#define BENCHMARK_PORT 8097
+
+namespace apps::benchmark {
+
+    static std::size_t fileSize = 64;
+    static std::size_t requests = 32;
+
+    static std::size_t completedRequests = 0;
+    static std::size_t receivedBytes = 0;
+
+    static std::chrono::steady_clock::time_point start;
+    static std::chrono::steady_clock::time_point end;
+
+    static rusage startUsage;
+    static rusage endUsage;
+
+    static bool readResponse(SSL* ssl) {
+        std::string header;
+        std::vector<char> chunk(1 << 16);
+
+        std::size_t headerEnd = std::string::npos;
+        while (headerEnd == std::string::npos) {
+            int ret = SSL_read(ssl, chunk.data(), static_cast<int>(chunk.size()));
+            if (ret <= 0) {
+                return false;
+            }
+            header.append(chunk.data(), static_cast<std::size_t>(ret));
+            headerEnd = header.find("\r\n\r\n");
+        }
+
+        std::size_t contentLengthPos = header.find("Content-Length: ");
+        if (contentLengthPos == std::string::npos || contentLengthPos > headerEnd) {
+            return false;
+        }
+
+        std::size_t contentLength = std::strtoul(header.c_str() + contentLengthPos + 16, nullptr, 10);
+        std::size_t received = header.size() - headerEnd - 4;
+
+        while (received < contentLength) {
+            int ret = SSL_read(ssl, chunk.data(), static_cast<int>(chunk.size()));
+            if (ret <= 0) {
+                return false;
+            }
+            received += static_cast<std::size_t>(ret);
+        }
+
+        receivedBytes += received;
+
+        return true;
+    }
+
+    static void client(core::EventLoop& eventLoop) {
+        SSL_CTX* ctx = SSL_CTX_new(TLS_client_method());
+        SSL* ssl = nullptr;
+
+        int fd = socket(AF_INET, SOCK_STREAM, 0);
+
+        sockaddr_in sockAddr{};
+        sockAddr.sin_family = AF_INET;
+        sockAddr.sin_port = htons(BENCHMARK_PORT);
+        sockAddr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+        if (ctx != nullptr && fd >= 0 && connect(fd, reinterpret_cast<sockaddr*>(&sockAddr), sizeof(sockAddr)) == 0) {
+            ssl = SSL_new(ctx);
+            SSL_set_fd(ssl, fd);
+
+            if (SSL_connect(ssl) == 1) {
+                const std::string request = "GET /file HTTP/1.1\r\nHost: localhost\r\nConnection: keep-alive\r\n\r\n";
+
+                start = std::chrono::steady_clock::now();
+                getrusage(RUSAGE_SELF, &startUsage);
+
+                for (; completedRequests < requests; completedRequests++) {
+                    if (SSL_write(ssl, request.data(), static_cast<int>(request.size())) <= 0 || !readResponse(ssl)) {
+                        LOG(ERROR) << "Client: request " << completedRequests << " failed";
+                        break;
+                    }
+                }
+
+                end = std::chrono::steady_clock::now();
+                getrusage(RUSAGE_SELF, &endUsage);
+
+                SSL_shutdown(ssl);
+            } else {
+                LOG(ERROR) << "Client: SSL/TLS handshake failed";
+            }
+        } else {
+            PLOG(ERROR) << "Client: connect";
+        }
+
+        if (ssl != nullptr) {
+            SSL_free(ssl);
+        }
+        if (fd >= 0) {
+            close(fd);
+        }
+        if (ctx != nullptr) {
+            SSL_CTX_free(ctx);
+        }
+
+        eventLoop.post([]() -> void {
+            core::SNodeC::stop();
+        });
+    }
+
+    static double cpuSeconds(const timeval& tv) {
+        return static_cast<double>(tv.tv_sec) + static_cast<double>(tv.tv_usec) / 1e6;
+    }
+
+} // namespace apps::benchmark
+
+int main(int argc, char* argv[]) {
+    using namespace apps::benchmark;
+
+    if (argc > 1 && std::isdigit(argv[1][0]) != 0) {
+        fileSize = std::strtoul(argv[1], nullptr, 10);
+    }
+    if (argc > 2 && std::isdigit(argv[2][0]) != 0) {
+        requests = std::strtoul(argv[2], nullptr, 10);
+    }
+
+    core::SNodeC::init(argc, argv);
+
+    std::string fileName = std::filesystem::temp_directory_path() / ("httpsfilebench-" + std::to_string(getpid()));
+    {
+        std::ofstream file(fileName, std::ios::binary);
+        std::vector<char> block(1 << 20, 'x');
+
+        for (std::size_t i = 0; i < fileSize; i++) {
+            file.write(block.data(), static_cast<std::streamsize>(block.size()));
+        }
+    }
+
+    using WebApp = express::tls::in::WebApp;
+
+    WebApp webApp("httpsfilebench", {{"CertChain", SERVERCERTF}, {"CertChainKey", SERVERKEYF}, {"Password", KEYFPASS}});
+
+    webApp.get("/file", [fileName] APPLICATION(req, res) {
+        res.sendFile(fileName, [&res](int errnum) -> void {
+            PLOG(ERROR) << "sendFile: " << errnum;
+            res.status(404).end();
+        });
+    });
+
+    std::thread clientThread;
+
+    webApp.listen(BENCHMARK_PORT, [&clientThread](const WebApp::SocketAddress& socketAddress, int errnum) -> void {
+        if (errnum != 0) {
+            PLOG(ERROR) << "OnError: " << socketAddress.toString();
+            core::SNodeC::stop();
+        } else {
+            clientThread = std::thread(client, std::ref(core::EventLoop::instance()));
+        }
+    });
+
+    int ret = core::SNodeC::start();
+
+    if (clientThread.joinable()) {
+        clientThread.join();
+    }
+
+    std::remove(fileName.c_str());
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    double userSeconds = cpuSeconds(endUsage.ru_utime) - cpuSeconds(startUsage.ru_utime);
+    double systemSeconds = cpuSeconds(endUsage.ru_stime) - cpuSeconds(startUsage.ru_stime);
+
+    std::cout << "kTLS: " << (webApp.getConfig().getKTls() ? "requested" : "off")
+              << ", kernel tls module: " << (std::filesystem::exists("/proc/net/tls_stat") ? "loaded" : "not loaded") << std::endl;
+    std::cout << "file: " << fileSize << " MiB, requests: " << completedRequests << std::endl;
+    if (completedRequests > 0) {
+        std::cout << "elapsed: " << seconds << " s, " << static_cast<double>(receivedBytes) / seconds / (1 << 20) << " MiB/s" << std::endl;
+        std::cout << "cpu user: " << userSeconds << " s, cpu system: " << systemSeconds << " s (server and client)" << std::endl;
+    }
+
+    return ret;
+}
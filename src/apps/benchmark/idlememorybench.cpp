@@ -0,0 +1,205 @@
+/*
+ * snode.c - a slim toolkit for network communication
+ * Copyright (C) 2020, 2021, 2022 Volker Christian <me@vchrist.at>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/EventLoop.h"
+#include "core/SNodeC.h"
+#include "core/socket/SocketContext.h"
+#include "core/socket/SocketContextFactory.h"
+#include "log/Logger.h"
+#include "net/in/stream/legacy/SocketServer.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <arpa/inet.h>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <netinet/in.h>
+#include <span>
+#include <string>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+// Resident memory per idle connection.
+// A client thread opens plain sockets to an echo server, exchanges one short message on each of them and leaves them idle.
+// The growth of the resident set size of the process divided by the number of connections is reported.
+// Compare a run with and one without a shared read buffer:
+//
+// Usage: idlememorybench [connections] [idlememorybench connection --shared-read-buffer]
+
+#define BENCHMARK_PORT 8096
+
+namespace apps::benchmark {
+
+    static std::size_t connections = 5000;
+
+    static std::vector<int> clientFds;
+
+    static long residentBytesStart = 0;
+    static long residentBytesIdle = 0;
+
+    static long residentBytes() {
+        std::ifstream statm("/proc/self/statm");
+
+        long pages = 0;
+        long residentPages = 0;
+        statm >> pages >> residentPages;
+
+        return residentPages * sysconf(_SC_PAGESIZE);
+    }
+
+    class EchoContext : public core::socket::SocketContext {
+    public:
+        explicit EchoContext(core::socket::SocketConnection* socketConnection)
+            : core::socket::SocketContext(socketConnection) {
+        }
+
+    private:
+        std::size_t onReceiveFromPeer() override {
+            std::span<const char> junk = peekFromPeer();
+
+            sendToPeer(junk.data(), junk.size());
+
+            return consumeFromPeer(junk.size());
+        }
+    };
+
+    class EchoContextFactory : public core::socket::SocketContextFactory {
+    private:
+        core::socket::SocketContext* create(core::socket::SocketConnection* socketConnection) override {
+            return new EchoContext(socketConnection);
+        }
+    };
+
+    static void client(core::EventLoop& eventLoop) {
+        sockaddr_in sockAddr{};
+        sockAddr.sin_family = AF_INET;
+        sockAddr.sin_port = htons(BENCHMARK_PORT);
+        sockAddr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+        const std::string message = "ping\n";
+
+        for (std::size_t i = 0; i < connections; i++) {
+            int fd = socket(AF_INET, SOCK_STREAM, 0);
+
+            if (fd < 0 || connect(fd, reinterpret_cast<sockaddr*>(&sockAddr), sizeof(sockAddr)) != 0) {
+                PLOG(ERROR) << "Client connect";
+                if (fd >= 0) {
+                    close(fd);
+                }
+                break;
+            }
+            clientFds.push_back(fd);
+
+            char echo[16];
+            std::size_t received = 0;
+            if (write(fd, message.data(), message.size()) == static_cast<ssize_t>(message.size())) {
+                while (received < message.size()) {
+                    ssize_t ret = read(fd, echo, sizeof(echo));
+                    if (ret <= 0) {
+                        break;
+                    }
+                    received += static_cast<std::size_t>(ret);
+                }
+            }
+            if (received < message.size()) {
+                PLOG(ERROR) << "Client echo";
+                break;
+            }
+        }
+
+        eventLoop.post([]() -> void {
+            residentBytesIdle = residentBytes();
+
+            core::SNodeC::stop();
+        });
+    }
+
+} // namespace apps::benchmark
+
+int main(int argc, char* argv[]) {
+    using namespace apps::benchmark;
+
+    if (argc > 1 && std::isdigit(argv[1][0]) != 0) {
+        connections = std::strtoul(argv[1], nullptr, 10);
+    }
+
+    // Both ends of each connection live in this process
+    rlimit noFile{};
+    if (getrlimit(RLIMIT_NOFILE, &noFile) == 0) {
+        noFile.rlim_cur = noFile.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &noFile);
+
+        if (noFile.rlim_cur < 2 * connections + 64) {
+            connections = (noFile.rlim_cur - 64) / 2;
+        }
+    }
+
+    core::SNodeC::init(argc, argv);
+
+    using EchoServer = net::in::stream::legacy::SocketServer<EchoContextFactory>;
+
+    EchoServer server(
+        "idlememorybench",
+        []([[maybe_unused]] EchoServer::SocketConnection* socketConnection) -> void { // onConnect
+        },
+        []([[maybe_unused]] EchoServer::SocketConnection* socketConnection) -> void { // onConnected
+        },
+        []([[maybe_unused]] EchoServer::SocketConnection* socketConnection) -> void { // onDisconnect
+        });
+
+    std::thread clientThread;
+
+    server.listen(BENCHMARK_PORT, 4096, [&clientThread](const EchoServer::SocketAddress& socketAddress, int errnum) -> void {
+        if (errnum != 0) {
+            PLOG(ERROR) << "OnError: " << socketAddress.toString();
+            core::SNodeC::stop();
+        } else {
+            residentBytesStart = residentBytes();
+
+            clientThread = std::thread(client, std::ref(core::EventLoop::instance()));
+        }
+    });
+
+    int ret = core::SNodeC::start();
+
+    if (clientThread.joinable()) {
+        clientThread.join();
+    }
+
+    for (int fd : clientFds) {
+        close(fd);
+    }
+
+    std::cout << "read buffer: " << (server.getConfig().getSharedReadBuffer() ? "shared per event loop" : "per connection")
+              << ", block size: " << server.getConfig().getReadBlockSize() << " bytes" << std::endl;
+    std::cout << "idle connections: " << clientFds.size() << std::endl;
+    if (!clientFds.empty()) {
+        std::cout << "resident: " << residentBytesIdle - residentBytesStart << " bytes, "
+                  << (residentBytesIdle - residentBytesStart) / static_cast<long>(clientFds.size()) << " bytes per idle connection"
+                  << std::endl;
+    }
+
+    return ret;
+}
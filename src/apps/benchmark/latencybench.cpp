@@ -0,0 +1,188 @@
+/*
+ * snode.c - a slim toolkit for network communication
+ * Copyright (C) 2020, 2021, 2022 Volker Christian <me@vchrist.at>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/SNodeC.h"
+#include "core/socket/SocketContext.h"
+#include "core/socket/SocketContextFactory.h"
+#include "log/Logger.h"
+#include "net/in/stream/legacy/SocketServer.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+// Dispatch latency benchmark for the busy poll mode of the event loop.
+// A sender thread writes timestamped messages with a pause in between, thus the event loop runs idle before each of them.
+// The event loop records the delay from the write until the message is dispatched to onReceiveFromPeer().
+//
+// Usage: latencybench-<mux> [samples [interval-us]] [--busy-poll <us>]
+
+#define BENCHMARK_PORT 8098
+
+namespace apps::benchmark {
+
+    static std::size_t samples = 10000;
+    static long interval = 200;
+
+    static std::vector<double> latencies;
+
+    static std::int64_t now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    static void sender() {
+        int fd = socket(AF_INET, SOCK_STREAM, 0);
+
+        sockaddr_in sockAddr{};
+        sockAddr.sin_family = AF_INET;
+        sockAddr.sin_port = htons(BENCHMARK_PORT);
+        sockAddr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+        if (fd >= 0 && connect(fd, reinterpret_cast<sockaddr*>(&sockAddr), sizeof(sockAddr)) == 0) {
+            for (std::size_t i = 0; i < samples; i++) {
+                std::this_thread::sleep_for(std::chrono::microseconds(interval));
+
+                std::int64_t timestamp = now();
+                if (write(fd, &timestamp, sizeof(timestamp)) != sizeof(timestamp)) {
+                    break;
+                }
+            }
+        } else {
+            PLOG(ERROR) << "Sender: connect";
+        }
+
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+
+    class LatencyContext : public core::socket::SocketContext {
+    public:
+        explicit LatencyContext(core::socket::SocketConnection* socketConnection)
+            : core::socket::SocketContext(socketConnection) {
+        }
+
+    private:
+        std::size_t onReceiveFromPeer() override {
+            std::int64_t dispatched = now();
+
+            std::size_t ret = readFromPeer(buffer + buffered, sizeof(buffer) - buffered);
+            buffered += ret;
+
+            std::size_t offset = 0;
+            for (; buffered - offset >= sizeof(std::int64_t); offset += sizeof(std::int64_t)) {
+                std::int64_t timestamp = 0;
+                std::memcpy(&timestamp, buffer + offset, sizeof(timestamp));
+
+                latencies.push_back(static_cast<double>(dispatched - timestamp) / 1e3);
+            }
+            std::memmove(buffer, buffer + offset, buffered - offset);
+            buffered -= offset;
+
+            if (latencies.size() >= samples) {
+                core::SNodeC::stop();
+            }
+
+            return ret;
+        }
+
+        void onDisconnected() override {
+            core::SNodeC::stop();
+        }
+
+        char buffer[4096];
+        std::size_t buffered = 0;
+    };
+
+    class LatencyContextFactory : public core::socket::SocketContextFactory {
+    private:
+        core::socket::SocketContext* create(core::socket::SocketConnection* socketConnection) override {
+            return new LatencyContext(socketConnection);
+        }
+    };
+
+    static double percentile(const std::vector<double>& sorted, double p) {
+        return sorted[std::min(sorted.size() - 1, static_cast<std::size_t>(p * static_cast<double>(sorted.size())))];
+    }
+
+} // namespace apps::benchmark
+
+int main(int argc, char* argv[]) {
+    using namespace apps::benchmark;
+
+    if (argc > 1 && argv[1][0] != '-') {
+        samples = std::strtoul(argv[1], nullptr, 10);
+    }
+    if (argc > 2 && argv[2][0] != '-') {
+        interval = std::strtol(argv[2], nullptr, 10);
+    }
+
+    core::SNodeC::init(argc, argv);
+
+    using LatencyServer = net::in::stream::legacy::SocketServer<LatencyContextFactory>;
+
+    LatencyServer server(
+        []([[maybe_unused]] LatencyServer::SocketConnection* socketConnection) -> void { // onConnect
+        },
+        []([[maybe_unused]] LatencyServer::SocketConnection* socketConnection) -> void { // onConnected
+        },
+        []([[maybe_unused]] LatencyServer::SocketConnection* socketConnection) -> void { // onDisconnect
+        });
+
+    std::thread senderThread;
+
+    server.listen(BENCHMARK_PORT, 5, [&senderThread](const LatencyServer::SocketAddress& socketAddress, int errnum) -> void {
+        if (errnum != 0) {
+            PLOG(ERROR) << "OnError: " << socketAddress.toString();
+            core::SNodeC::stop();
+        } else {
+            senderThread = std::thread(sender);
+        }
+    });
+
+    latencies.reserve(samples);
+
+    int ret = core::SNodeC::start();
+
+    if (senderThread.joinable()) {
+        senderThread.join();
+    }
+
+    if (!latencies.empty()) {
+        std::sort(latencies.begin(), latencies.end());
+
+        std::cout << "samples: " << latencies.size() << ", interval: " << interval << " us" << std::endl;
+        std::cout << "dispatch latency: p50 " << percentile(latencies, 0.5) << " us, p99 " << percentile(latencies, 0.99) << " us, p99.9 "
+                  << percentile(latencies, 0.999) << " us, max " << latencies.back() << " us" << std::endl;
+    }
+
+    return ret;
+}
@@ -0,0 +1,221 @@
+/*
+ * snode.c - a slim toolkit for network communication
+ * Copyright (C) 2020, 2021, 2022 Volker Christian <me@vchrist.at>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/SNodeC.h"
+#include "core/socket/SocketContext.h"
+#include "core/socket/SocketContextFactory.h"
+#include "log/Logger.h"
+#include "net/in/stream/legacy/SocketClient.h"
+#include "net/in/stream/legacy/SocketServer.h"
+
+#if defined(LOOPBACKBENCH_EPOLL)
+#include "core/multiplexer/epoll/EventMultiplexer.h"
+#endif
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <sys/resource.h>
+#include <sys/time.h>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+// Loopback ping-pong benchmark for comparing the I/O-multiplexers.
+// The same source is linked once per multiplexer (loopbackbench-epoll, loopbackbench-iouring, ...).
+//
+// The epoll variants also report the number of epoll_ctl calls per round trip.
+//
+// Usage: loopbackbench-<mux> [connections [roundtrips [payload]]]
+
+#define BENCHMARK_PORT 8099
+
+namespace apps::benchmark {
+
+    static std::size_t connections = 64;
+    static std::size_t roundTrips = 10000;
+    static std::size_t payloadSize = 64;
+
+    static std::size_t finishedConnections = 0;
+    static std::size_t totalRoundTrips = 0;
+
+    static std::chrono::steady_clock::time_point end;
+    static rusage endUsage;
+
+    class EchoContext : public core::socket::SocketContext {
+    public:
+        explicit EchoContext(core::socket::SocketConnection* socketConnection)
+            : core::socket::SocketContext(socketConnection) {
+        }
+
+    private:
+        std::size_t onReceiveFromPeer() override {
+            char chunk[16384];
+
+            std::size_t ret = readFromPeer(chunk, sizeof(chunk));
+            if (ret > 0) {
+                sendToPeer(chunk, ret);
+            }
+
+            return ret;
+        }
+    };
+
+    class PingContext : public core::socket::SocketContext {
+    public:
+        explicit PingContext(core::socket::SocketConnection* socketConnection)
+            : core::socket::SocketContext(socketConnection)
+            , payload(payloadSize, 'x') {
+        }
+
+    private:
+        void onConnected() override {
+            sendToPeer(payload);
+        }
+
+        std::size_t onReceiveFromPeer() override {
+            char chunk[16384];
+
+            std::size_t ret = readFromPeer(chunk, sizeof(chunk));
+            received += ret;
+
+            if (received >= payload.size()) {
+                received -= payload.size();
+                totalRoundTrips++;
+
+                if (++roundTripCount < roundTrips) {
+                    sendToPeer(payload);
+                } else if (++finishedConnections == connections) {
+                    end = std::chrono::steady_clock::now();
+                    getrusage(RUSAGE_SELF, &endUsage);
+
+                    core::SNodeC::stop();
+                }
+            }
+
+            return ret;
+        }
+
+        std::string payload;
+        std::size_t received = 0;
+        std::size_t roundTripCount = 0;
+    };
+
+    class EchoContextFactory : public core::socket::SocketContextFactory {
+    private:
+        core::socket::SocketContext* create(core::socket::SocketConnection* socketConnection) override {
+            return new EchoContext(socketConnection);
+        }
+    };
+
+    class PingContextFactory : public core::socket::SocketContextFactory {
+    private:
+        core::socket::SocketContext* create(core::socket::SocketConnection* socketConnection) override {
+            return new PingContext(socketConnection);
+        }
+    };
+
+    static double cpuSeconds(const timeval& tv) {
+        return static_cast<double>(tv.tv_sec) + static_cast<double>(tv.tv_usec) / 1e6;
+    }
+
+} // namespace apps::benchmark
+
+int main(int argc, char* argv[]) {
+    using namespace apps::benchmark;
+
+    if (argc > 1) {
+        connections = std::strtoul(argv[1], nullptr, 10);
+    }
+    if (argc > 2) {
+        roundTrips = std::strtoul(argv[2], nullptr, 10);
+    }
+    if (argc > 3) {
+        payloadSize = std::strtoul(argv[3], nullptr, 10);
+    }
+
+    core::SNodeC::init(argc, argv);
+
+    using EchoServer = net::in::stream::legacy::SocketServer<EchoContextFactory>;
+    using PingClient = net::in::stream::legacy::SocketClient<PingContextFactory>;
+
+    EchoServer server(
+        []([[maybe_unused]] EchoServer::SocketConnection* socketConnection) -> void { // onConnect
+        },
+        []([[maybe_unused]] EchoServer::SocketConnection* socketConnection) -> void { // onConnected
+        },
+        []([[maybe_unused]] EchoServer::SocketConnection* socketConnection) -> void { // onDisconnect
+        });
+
+    PingClient client(
+        []([[maybe_unused]] PingClient::SocketConnection* socketConnection) -> void { // onConnect
+        },
+        []([[maybe_unused]] PingClient::SocketConnection* socketConnection) -> void { // onConnected
+        },
+        []([[maybe_unused]] PingClient::SocketConnection* socketConnection) -> void { // onDisconnect
+        });
+
+    server.listen(BENCHMARK_PORT, 128, [&client](const EchoServer::SocketAddress& socketAddress, int errnum) -> void {
+        if (errnum != 0) {
+            PLOG(ERROR) << "OnError: " << socketAddress.toString();
+            core::SNodeC::stop();
+        } else {
+            for (std::size_t i = 0; i < connections; i++) {
+                client.connect("127.0.0.1", BENCHMARK_PORT, [](const PingClient::SocketAddress& socketAddress, int errnum) -> void {
+                    if (errnum != 0) {
+                        PLOG(ERROR) << "OnError: " << socketAddress.toString();
+                        core::SNodeC::stop();
+                    }
+                });
+            }
+        }
+    });
+
+    rusage startUsage;
+    getrusage(RUSAGE_SELF, &startUsage);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    int ret = core::SNodeC::start();
+
+    if (finishedConnections < connections) {
+        end = std::chrono::steady_clock::now();
+        getrusage(RUSAGE_SELF, &endUsage);
+    }
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    double userSeconds = cpuSeconds(endUsage.ru_utime) - cpuSeconds(startUsage.ru_utime);
+    double systemSeconds = cpuSeconds(endUsage.ru_stime) - cpuSeconds(startUsage.ru_stime);
+
+    std::cout << "connections: " << connections << ", round trips: " << totalRoundTrips << ", payload: " << payloadSize << " bytes"
+              << std::endl;
+    std::cout << "elapsed: " << seconds << " s, " << static_cast<double>(totalRoundTrips) / seconds << " round trips/s, "
+              << seconds * 1e6 * static_cast<double>(connections) / static_cast<double>(totalRoundTrips) << " us/round trip"
+              << std::endl;
+    std::cout << "cpu user: " << userSeconds << " s, cpu system: " << systemSeconds << " s" << std::endl;
+
+#if defined(LOOPBACKBENCH_EPOLL)
+    unsigned long ePollCtlCount = static_cast<core::epoll::EventMultiplexer&>(EventMultiplexer()).getEPollCtlCount();
+
+    std::cout << "epoll_ctl calls: " << ePollCtlCount << ", "
+              << static_cast<double>(ePollCtlCount) / static_cast<double>(totalRoundTrips) << " per round trip" << std::endl;
+#endif
+
+    return ret;
+}
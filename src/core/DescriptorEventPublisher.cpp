@@ -19,15 +19,11 @@
 #include "core/DescriptorEventPublisher.h"
 
 #include "core/DescriptorEventReceiver.h"
+#include "core/EventLoop.h"
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
 #include <algorithm>
-#include <iterator>
-#include <type_traits>
-#include <utility>
-
-// IWYU pragma: no_include <bits/utility.h>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
@@ -39,16 +35,42 @@ namespace core {
 
     void DescriptorEventPublisher::enable(DescriptorEventReceiver* descriptorEventReceiver) {
         int fd = descriptorEventReceiver->getRegisteredFd();
-        descriptorEventReceiver->setEnabled(utils::Timeval::currentTime());
-        observedEventReceivers[fd].push_front(descriptorEventReceiver);
+        descriptorEventReceiver->setEnabled(EventLoop::getCurrentTime());
+
+        if (descriptorEventReceiver->observedEventReceiverFd >= 0) { // Re-enabled before its disable has been released
+            unlinkObservedEventReceiver(descriptorEventReceiver);
+            descriptorEventReceiver->setDisabled();
+        }
+
+        if (static_cast<std::size_t>(fd) >= observedEventReceivers.size()) {
+            observedEventReceivers.resize(std::max(static_cast<std::size_t>(fd) + 1, 2 * observedEventReceivers.size()), nullptr);
+        }
+
+        DescriptorEventReceiver*& head = observedEventReceivers[static_cast<std::size_t>(fd)];
+        if (head != nullptr) {
+            timeoutHeapErase(head);
+        } else {
+            maxFd = std::max(maxFd, fd);
+        }
+        descriptorEventReceiver->nextObservedEventReceiver = head;
+        descriptorEventReceiver->observedEventReceiverFd = fd;
+        head = descriptorEventReceiver;
+        if (descriptorEventReceiver->isKeepingEventLoopAlive()) {
+            observedEventReceiverCount++;
+        }
+        timeoutHeapInsert(descriptorEventReceiver);
+
         muxAdd(descriptorEventReceiver);
         if (descriptorEventReceiver->isSuspended()) {
             muxOff(descriptorEventReceiver);
         }
     }
 
-    void DescriptorEventPublisher::disable([[maybe_unused]] DescriptorEventReceiver* descriptorEventReceiver) {
-        observedEventReceiversDirty = true;
+    void DescriptorEventPublisher::disable(DescriptorEventReceiver* descriptorEventReceiver) {
+        if (!descriptorEventReceiver->releasePending) {
+            descriptorEventReceiver->releasePending = true;
+            disabledEventReceivers.push_back(descriptorEventReceiver);
+        }
     }
 
     void DescriptorEventPublisher::suspend(DescriptorEventReceiver* descriptorEventReceiver) {
@@ -60,73 +82,208 @@ namespace core {
     }
 
     void DescriptorEventPublisher::checkTimedOutEvents(const utils::Timeval& currentTime) {
-        for (const auto& [fd, eventReceivers] : observedEventReceivers) {
-            eventReceivers.front()->checkTimeout(currentTime);
+        while (!timeoutHeap.empty() && timeoutHeap.front()->timeoutHeapDeadline <= currentTime) {
+            DescriptorEventReceiver* descriptorEventReceiver = timeoutHeap.front();
+            utils::Timeval deadline = descriptorEventReceiver->getDeadline();
+
+            if (deadline <= currentTime) {
+                timeoutHeapErase(descriptorEventReceiver);
+                timedOutEventReceivers.push_back(descriptorEventReceiver);
+            } else {
+                descriptorEventReceiver->timeoutHeapDeadline = deadline;
+                timeoutHeapSiftDown(0);
+            }
+        }
+
+        for (DescriptorEventReceiver* descriptorEventReceiver : timedOutEventReceivers) {
+            timeoutHeapInsert(descriptorEventReceiver);
+        }
+
+        for (DescriptorEventReceiver* descriptorEventReceiver : timedOutEventReceivers) {
+            descriptorEventReceiver->checkTimeout(currentTime);
         }
+        timedOutEventReceivers.clear();
     }
 
     void DescriptorEventPublisher::releaseDisabledEvents(const utils::Timeval& currentTime) {
-        if (observedEventReceiversDirty) {
-            observedEventReceiversDirty = false;
-
-            for (auto& [fd, observedEventReceiverList] : observedEventReceivers) {
-                DescriptorEventReceiver* beforeFirst = observedEventReceiverList.front();
-                if (std::erase_if(observedEventReceiverList, [](DescriptorEventReceiver* descriptorEventReceiver) -> bool {
-                        bool isDisabled = !descriptorEventReceiver->isEnabled();
-                        if (isDisabled) {
-                            descriptorEventReceiver->setDisabled();
-                            if (!descriptorEventReceiver->isObserved()) {
-                                descriptorEventReceiver->unobservedEvent();
-                            }
-                        }
-                        return isDisabled;
-                    }) > 0) {
-                    if (observedEventReceiverList.empty()) {
-                        muxDel(fd);
+        // unobservedEvent() may disable further receivers, thus only the entries present on entry are processed by index
+        std::size_t count = disabledEventReceivers.size();
+
+        for (std::size_t i = 0; i < count; i++) {
+            DescriptorEventReceiver* descriptorEventReceiver = disabledEventReceivers[i];
+            descriptorEventReceiver->releasePending = false;
+
+            int fd = descriptorEventReceiver->observedEventReceiverFd;
+            if (!descriptorEventReceiver->isEnabled() && fd >= 0) {
+                bool wasHead = observedEventReceivers[static_cast<std::size_t>(fd)] == descriptorEventReceiver;
+
+                unlinkObservedEventReceiver(descriptorEventReceiver);
+                timeoutHeapErase(descriptorEventReceiver);
+
+                DescriptorEventReceiver* head = observedEventReceivers[static_cast<std::size_t>(fd)];
+                if (head == nullptr) {
+                    muxDel(fd);
+
+                    while (maxFd >= 0 && observedEventReceivers[static_cast<std::size_t>(maxFd)] == nullptr) {
+                        maxFd--;
+                    }
+                } else if (wasHead) {
+                    head->triggered(currentTime);
+                    timeoutHeapInsert(head);
+                    if (!head->isSuspended()) {
+                        muxOn(head);
                     } else {
-                        DescriptorEventReceiver* afterFirst = observedEventReceiverList.front();
-                        if (beforeFirst != afterFirst) {
-                            afterFirst->triggered(currentTime);
-                            if (!afterFirst->isSuspended()) {
-                                muxOn(afterFirst);
-                            } else {
-                                muxOff(afterFirst);
-                            }
-                        }
+                        muxOff(head);
                     }
                 }
+
+                descriptorEventReceiver->setDisabled();
+                if (!descriptorEventReceiver->isObserved()) {
+                    descriptorEventReceiver->unobservedEvent();
+                }
             }
+        }
+
+        disabledEventReceivers.erase(disabledEventReceivers.begin(), disabledEventReceivers.begin() + static_cast<std::ptrdiff_t>(count));
+    }
+
+    void DescriptorEventPublisher::unlinkObservedEventReceiver(DescriptorEventReceiver* descriptorEventReceiver) {
+        DescriptorEventReceiver** link = &observedEventReceivers[static_cast<std::size_t>(descriptorEventReceiver->observedEventReceiverFd)];
+
+        while (*link != descriptorEventReceiver) {
+            link = &(*link)->nextObservedEventReceiver;
+        }
+        *link = descriptorEventReceiver->nextObservedEventReceiver;
 
-            std::erase_if(observedEventReceivers, [](auto& observedEventReceiversEntry) -> bool {
-                return observedEventReceiversEntry.second.empty();
-            });
+        descriptorEventReceiver->nextObservedEventReceiver = nullptr;
+        descriptorEventReceiver->observedEventReceiverFd = -1;
+
+        if (descriptorEventReceiver->isKeepingEventLoopAlive()) {
+            observedEventReceiverCount--;
         }
     }
 
-    int DescriptorEventPublisher::getObservedEventReceiverCount() const {
-        return static_cast<int>(observedEventReceivers.size());
+    DescriptorEventReceiver* DescriptorEventPublisher::getObservedEventReceiver(int fd) const {
+        return fd >= 0 && static_cast<std::size_t>(fd) < observedEventReceivers.size() ? observedEventReceivers[static_cast<std::size_t>(fd)]
+                                                                                        : nullptr;
     }
 
-    int DescriptorEventPublisher::getMaxFd() const {
-        int maxFd = -1;
+    void DescriptorEventPublisher::updateTimeout(DescriptorEventReceiver* descriptorEventReceiver) {
+        std::size_t index = descriptorEventReceiver->timeoutHeapIndex;
 
-        if (!observedEventReceivers.empty()) {
-            maxFd = observedEventReceivers.rbegin()->first;
+        if (index != DescriptorEventReceiver::TIMEOUT_HEAP_NONE) {
+            utils::Timeval deadline = descriptorEventReceiver->getDeadline();
+
+            if (deadline < descriptorEventReceiver->timeoutHeapDeadline) {
+                descriptorEventReceiver->timeoutHeapDeadline = deadline;
+                timeoutHeapSiftUp(index);
+            } else {
+                descriptorEventReceiver->timeoutHeapDeadline = deadline;
+                timeoutHeapSiftDown(index);
+            }
         }
+    }
+
+    void DescriptorEventPublisher::timeoutHeapInsert(DescriptorEventReceiver* descriptorEventReceiver) {
+        if (descriptorEventReceiver->timeoutHeapIndex == DescriptorEventReceiver::TIMEOUT_HEAP_NONE) {
+            descriptorEventReceiver->timeoutHeapDeadline = descriptorEventReceiver->getDeadline();
+
+            timeoutHeap.push_back(descriptorEventReceiver);
+            descriptorEventReceiver->timeoutHeapIndex = timeoutHeap.size() - 1;
 
+            timeoutHeapSiftUp(timeoutHeap.size() - 1);
+        }
+    }
+
+    void DescriptorEventPublisher::timeoutHeapErase(DescriptorEventReceiver* descriptorEventReceiver) {
+        std::size_t index = descriptorEventReceiver->timeoutHeapIndex;
+
+        if (index != DescriptorEventReceiver::TIMEOUT_HEAP_NONE) {
+            descriptorEventReceiver->timeoutHeapIndex = DescriptorEventReceiver::TIMEOUT_HEAP_NONE;
+
+            DescriptorEventReceiver* last = timeoutHeap.back();
+            timeoutHeap.pop_back();
+
+            if (last != descriptorEventReceiver) {
+                timeoutHeapPlace(index, last);
+
+                if (index > 0 && last->timeoutHeapDeadline < timeoutHeap[(index - 1) / 2]->timeoutHeapDeadline) {
+                    timeoutHeapSiftUp(index);
+                } else {
+                    timeoutHeapSiftDown(index);
+                }
+            }
+        }
+    }
+
+    void DescriptorEventPublisher::timeoutHeapSiftUp(std::size_t index) {
+        DescriptorEventReceiver* descriptorEventReceiver = timeoutHeap[index];
+
+        while (index > 0) {
+            std::size_t parent = (index - 1) / 2;
+
+            if (!(descriptorEventReceiver->timeoutHeapDeadline < timeoutHeap[parent]->timeoutHeapDeadline)) {
+                break;
+            }
+
+            timeoutHeapPlace(index, timeoutHeap[parent]);
+            index = parent;
+        }
+
+        timeoutHeapPlace(index, descriptorEventReceiver);
+    }
+
+    void DescriptorEventPublisher::timeoutHeapSiftDown(std::size_t index) {
+        DescriptorEventReceiver* descriptorEventReceiver = timeoutHeap[index];
+        std::size_t size = timeoutHeap.size();
+
+        for (;;) {
+            std::size_t child = 2 * index + 1;
+
+            if (child >= size) {
+                break;
+            }
+            if (child + 1 < size && timeoutHeap[child + 1]->timeoutHeapDeadline < timeoutHeap[child]->timeoutHeapDeadline) {
+                child++;
+            }
+            if (!(timeoutHeap[child]->timeoutHeapDeadline < descriptorEventReceiver->timeoutHeapDeadline)) {
+                break;
+            }
+
+            timeoutHeapPlace(index, timeoutHeap[child]);
+            index = child;
+        }
+
+        timeoutHeapPlace(index, descriptorEventReceiver);
+    }
+
+    void DescriptorEventPublisher::timeoutHeapPlace(std::size_t index, DescriptorEventReceiver* descriptorEventReceiver) {
+        timeoutHeap[index] = descriptorEventReceiver;
+        descriptorEventReceiver->timeoutHeapIndex = index;
+    }
+
+    int DescriptorEventPublisher::getObservedEventReceiverCount() const {
+        return observedEventReceiverCount;
+    }
+
+    std::size_t DescriptorEventPublisher::getPublishStart(std::size_t count) {
+        return count > 0 ? publishRotation++ % count : 0;
+    }
+
+    unsigned long DescriptorEventPublisher::getEventCounter() const {
+        return eventCounter;
+    }
+
+    int DescriptorEventPublisher::getMaxFd() const {
         return maxFd;
     }
 
     utils::Timeval DescriptorEventPublisher::getNextTimeout(const utils::Timeval& currentTime) const {
         utils::Timeval nextTimeout = DescriptorEventReceiver::TIMEOUT::MAX;
 
-        if (!observedEventReceiversDirty) {
-            for (const auto& [fd, eventReceivers] : observedEventReceivers) {
-                const DescriptorEventReceiver* eventReceiver = eventReceivers.front();
-
-                if (!eventReceiver->isSuspended()) {
-                    nextTimeout = std::min(eventReceiver->getTimeout(currentTime), nextTimeout);
-                }
+        if (disabledEventReceivers.empty()) {
+            if (!timeoutHeap.empty()) {
+                nextTimeout = std::min(timeoutHeap.front()->timeoutHeapDeadline - currentTime, nextTimeout);
             }
         } else {
             nextTimeout = 0;
@@ -136,8 +293,9 @@ namespace core {
     }
 
     void DescriptorEventPublisher::stop() {
-        for (const auto& [fd, eventReceivers] : observedEventReceivers) {
-            for (DescriptorEventReceiver* eventReceiver : eventReceivers) {
+        for (int fd = 0; fd <= maxFd; fd++) {
+            for (DescriptorEventReceiver* eventReceiver = observedEventReceivers[static_cast<std::size_t>(fd)]; eventReceiver != nullptr;
+                 eventReceiver = eventReceiver->nextObservedEventReceiver) {
                 eventReceiver->terminate();
             }
         }
@@ -30,9 +30,9 @@ namespace utils {
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
-#include <list> // IWYU pragma: export
-#include <map>  // IWYU pragma: export
+#include <cstddef>
 #include <string>
+#include <vector>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
@@ -60,8 +60,11 @@ namespace core {
         void checkTimedOutEvents(const utils::Timeval& currentTime);
         void releaseDisabledEvents(const utils::Timeval& currentTime);
 
+        void updateTimeout(DescriptorEventReceiver* descriptorEventReceiver);
+
         int getObservedEventReceiverCount() const;
         int getMaxFd() const;
+        unsigned long getEventCounter() const;
 
         utils::Timeval getNextTimeout(const utils::Timeval& currentTime) const;
 
@@ -75,12 +78,37 @@ namespace core {
         virtual void muxOn(DescriptorEventReceiver* descriptorEventReceiver) = 0;
         virtual void muxOff(DescriptorEventReceiver* descriptorEventReceiver) = 0;
 
-        std::map<int, std::list<DescriptorEventReceiver*>> observedEventReceivers;
+        // Active receiver of fd, i.e. the head of the chain of receivers observing fd, or nullptr
+        DescriptorEventReceiver* getObservedEventReceiver(int fd) const;
+
+        // Round robin: the position ready receivers are published from advances each tick, thus low fds are not always served first
+        std::size_t getPublishStart(std::size_t count);
 
         unsigned long eventCounter = 0;
-        bool observedEventReceiversDirty = false;
 
         std::string name;
+
+    private:
+        void unlinkObservedEventReceiver(DescriptorEventReceiver* descriptorEventReceiver);
+
+        // Indexed by fd: heads of intrusive chains linked via DescriptorEventReceiver::nextObservedEventReceiver
+        std::vector<DescriptorEventReceiver*> observedEventReceivers;
+        int observedEventReceiverCount = 0; // Linked receivers which keep the event loop alive
+        int maxFd = -1;
+
+        std::size_t publishRotation = 0;
+
+        std::vector<DescriptorEventReceiver*> disabledEventReceivers;
+
+        // Indexed min-heap of the active receiver of each fd ordered by its inactivity deadline
+        void timeoutHeapInsert(DescriptorEventReceiver* descriptorEventReceiver);
+        void timeoutHeapErase(DescriptorEventReceiver* descriptorEventReceiver);
+        void timeoutHeapSiftUp(std::size_t index);
+        void timeoutHeapSiftDown(std::size_t index);
+        void timeoutHeapPlace(std::size_t index, DescriptorEventReceiver* descriptorEventReceiver);
+
+        std::vector<DescriptorEventReceiver*> timeoutHeap;
+        std::vector<DescriptorEventReceiver*> timedOutEventReceivers;
     };
 
 } // namespace core
@@ -105,7 +105,7 @@ namespace core {
         if (enabled) {
             if (suspended) {
                 suspended = false;
-                lastTriggered = utils::Timeval::currentTime();
+                triggered(EventLoop::getCurrentTime());
 
                 if (isObserved()) {
                     descriptorEventPublisher.resume(this);
@@ -122,6 +122,22 @@ namespace core {
         return suspended;
     }
 
+    bool DescriptorEventReceiver::isEdgeTriggerable() const {
+        return edgeTriggerable;
+    }
+
+    void DescriptorEventReceiver::setEdgeTriggerable(bool edgeTriggerable) {
+        this->edgeTriggerable = edgeTriggerable;
+    }
+
+    bool DescriptorEventReceiver::isKeepingEventLoopAlive() const {
+        return keepEventLoopAlive;
+    }
+
+    void DescriptorEventReceiver::setKeepEventLoopAlive(bool keepEventLoopAlive) {
+        this->keepEventLoopAlive = keepEventLoopAlive;
+    }
+
     void DescriptorEventReceiver::terminate() {
         if (isEnabled()) {
             disable();
@@ -135,7 +151,11 @@ namespace core {
             this->maxInactivity = timeout;
         }
 
-        triggered(utils::Timeval::currentTime());
+        lastTriggered = EventLoop::getCurrentTime();
+
+        if (timeoutHeapIndex != TIMEOUT_HEAP_NONE) {
+            descriptorEventPublisher.updateTimeout(this);
+        }
     }
 
     utils::Timeval DescriptorEventReceiver::getTimeout(const utils::Timeval& currentTime) const {
@@ -151,6 +171,15 @@ namespace core {
 
     void DescriptorEventReceiver::triggered(const utils::Timeval& currentTime) {
         lastTriggered = currentTime;
+
+        // Moving the deadline later leaves the heap valid - it is resorted lazily when the old deadline is reached
+        if (timeoutHeapIndex != TIMEOUT_HEAP_NONE && getDeadline() < timeoutHeapDeadline) {
+            descriptorEventPublisher.updateTimeout(this);
+        }
+    }
+
+    utils::Timeval DescriptorEventReceiver::getDeadline() const {
+        return (maxInactivity >= 0 && maxInactivity < TIMEOUT::MAX - lastTriggered) ? lastTriggered + maxInactivity : TIMEOUT::MAX;
     }
 
     void DescriptorEventReceiver::checkTimeout(const utils::Timeval& currentTime) {
@@ -29,6 +29,7 @@ namespace core {
 
 #include "utils/Timeval.h" // IWYU pragma: export
 
+#include <cstddef>
 #include <string>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
@@ -92,6 +93,9 @@ namespace core {
         bool isEnabled() const;
         bool isSuspended() const;
 
+        bool isEdgeTriggerable() const;
+        bool isKeepingEventLoopAlive() const;
+
         void setTimeout(const utils::Timeval& timeout);
         utils::Timeval getTimeout(const utils::Timeval& currentTime) const;
 
@@ -99,12 +103,21 @@ namespace core {
 
         virtual void terminate();
 
+    protected:
+        // Receivers which always drain their descriptor until EAGAIN before they resume may be served edge-triggered
+        void setEdgeTriggerable(bool edgeTriggerable);
+
+        // Receivers serving the event loop itself (e.g. signal delivery) do not keep it running once all others are gone
+        void setKeepEventLoopAlive(bool keepEventLoopAlive);
+
     private:
         void event(const utils::Timeval& currentTime) final;
         void triggered(const utils::Timeval& currentTime);
         void setEnabled(const utils::Timeval& currentTime);
         void setDisabled();
 
+        utils::Timeval getDeadline() const;
+
         virtual void dispatchEvent() = 0;
         virtual void timeoutEvent() = 0;
 
@@ -114,6 +127,8 @@ namespace core {
 
         bool enabled = false;
         bool suspended = false;
+        bool edgeTriggerable = false;
+        bool keepEventLoopAlive = true;
 
         utils::Timeval lastTriggered;
         utils::Timeval maxInactivity;
@@ -121,6 +136,17 @@ namespace core {
 
         int eventCounter = 0;
 
+        // Chain of receivers observing the same fd: fd the receiver is linked for (-1 if unlinked) and successor
+        int observedEventReceiverFd = -1;
+        DescriptorEventReceiver* nextObservedEventReceiver = nullptr;
+        bool releasePending = false;
+
+        // Position in the timeout heap of the publisher and a lower bound of the deadline it is sorted by
+        static const std::size_t TIMEOUT_HEAP_NONE = static_cast<std::size_t>(-1);
+
+        std::size_t timeoutHeapIndex = TIMEOUT_HEAP_NONE;
+        utils::Timeval timeoutHeapDeadline;
+
         friend class DescriptorEventPublisher;
     };
 
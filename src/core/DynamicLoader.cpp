@@ -30,8 +30,11 @@ namespace core {
 
     std::map<void*, DynamicLoader::Library> DynamicLoader::dlOpenedLibraries;
     std::map<void*, std::size_t> DynamicLoader::registeredForDlClose;
+    std::recursive_mutex DynamicLoader::dynamicLoaderMutex;
 
     void* DynamicLoader::dlOpen(const std::string& libFile, int flags) {
+        std::scoped_lock<std::recursive_mutex> lock(dynamicLoaderMutex);
+
         VLOG(0) << "dlOpen: " << libFile;
 
         void* handle = core::system::dlopen(libFile.c_str(), flags);
@@ -47,6 +50,8 @@ namespace core {
     }
 
     void DynamicLoader::dlCloseDelayed(void* handle) {
+        std::scoped_lock<std::recursive_mutex> lock(dynamicLoaderMutex);
+
         if (handle != nullptr) {
             if (dlOpenedLibraries.contains(handle)) {
                 VLOG(0) << "dlCloseDelayed: " << dlOpenedLibraries[handle].fileName;
@@ -61,6 +66,8 @@ namespace core {
     }
 
     int DynamicLoader::dlClose(void* handle) {
+        std::scoped_lock<std::recursive_mutex> lock(dynamicLoaderMutex);
+
         int ret = 0;
 
         if (handle != nullptr) {
@@ -106,6 +113,8 @@ namespace core {
     }
 
     void DynamicLoader::execDlCloseDeleyed() {
+        std::scoped_lock<std::recursive_mutex> lock(dynamicLoaderMutex);
+
         for (auto& [handle, refCount] : registeredForDlClose) {
             do {
                 int ret = execDlClose(handle);
@@ -120,6 +129,8 @@ namespace core {
     }
 
     void DynamicLoader::execDlCloseAll() {
+        std::scoped_lock<std::recursive_mutex> lock(dynamicLoaderMutex);
+
         execDlCloseDeleyed();
 
         std::map<void*, Library>::iterator it = dlOpenedLibraries.begin();
@@ -25,6 +25,7 @@
 
 #include <cstddef>
 #include <map>
+#include <mutex>
 #include <string>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
@@ -59,6 +60,9 @@ namespace core {
         static std::map<void*, Library> dlOpenedLibraries;
         static std::map<void*, std::size_t> registeredForDlClose;
 
+        // Libraries may be opened and closed from any event loop thread
+        static std::recursive_mutex dynamicLoaderMutex;
+
         friend class EventLoop;
         friend class EventMultiplexer;
     };
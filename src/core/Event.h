@@ -55,6 +55,10 @@ namespace core {
 
         std::string name;
 
+        // Links of the event queue: successor and the link pointing to this event while queued
+        Event* nextEvent = nullptr;
+        Event** prevNextEvent = nullptr;
+
         friend class EventMultiplexer;
     };
 
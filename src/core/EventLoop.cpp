@@ -20,28 +20,51 @@
 
 #include "core/DynamicLoader.h"
 #include "core/EventMultiplexer.h"
+#include "core/SignalEventReceiver.h"
+#include "core/WakeUpEventReceiver.h"
+#include "core/timer/Timer.h"
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
+#include "core/system/pthread.h"
 #include "core/system/signal.h"
 #include "log/Logger.h"
 #include "utils/Config.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <string>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
+#ifndef HANDOVER_DRAIN_TIMEOUT
+#define HANDOVER_DRAIN_TIMEOUT 10
+#endif
+
 /* Must be implemented in every variant of a multiplexer api */
 core::EventMultiplexer& EventMultiplexer();
 
 namespace core {
 
     bool EventLoop::initialized = false;
-    bool EventLoop::running = false;
-    bool EventLoop::stopped = true;
+    thread_local bool EventLoop::running = false;
+    thread_local bool EventLoop::stopped = true;
     int EventLoop::stopsig = 0;
-    unsigned long EventLoop::tickCounter = 0;
+    thread_local unsigned long EventLoop::tickCounter = 0;
+
+    std::vector<EventLoop::EventLoopInitializer> EventLoop::eventLoopInitializers;
+    bool EventLoop::cpuAffinity = false;
+
+    std::vector<std::thread> EventLoop::eventLoopThreads;
+    std::atomic<bool> EventLoop::eventLoopThreadsStopped = false;
+    std::mutex EventLoop::eventLoopsMutex;
+    std::vector<EventLoop*> EventLoop::eventLoops;
+
+    std::atomic<int> EventLoop::eventLoopThreadsRunning = 0;
+    EventLoop* EventLoop::mainEventLoop = nullptr;
+
+    std::atomic<int> EventLoop::listeners = 0;
+    std::atomic<bool> EventLoop::listenersHandedOver = false;
 
     static std::string getTickCounterAsString(const el::LogMessage*) {
         std::string tick = std::to_string(EventLoop::getTickCounter());
@@ -60,7 +83,7 @@ namespace core {
     }
 
     EventLoop& EventLoop::instance() {
-        static EventLoop eventLoop;
+        static thread_local EventLoop eventLoop;
 
         return eventLoop;
     }
@@ -69,16 +92,55 @@ namespace core {
         return tickCounter;
     }
 
+    utils::Timeval EventLoop::getCurrentTime() {
+        return EventLoop::instance().eventMultiplexer.getCurrentTime();
+    }
+
+    bool EventLoop::isStopPending() {
+        return running && (stopped || (EventLoop::instance().eventLoopIndex > 0 && eventLoopThreadsStopped));
+    }
+
     EventMultiplexer& EventLoop::getEventMultiplexer() {
         return eventMultiplexer;
     }
 
+    int EventLoop::getEventLoopIndex() {
+        return EventLoop::instance().eventLoopIndex;
+    }
+
+    void EventLoop::post(const std::function<void()>& task) {
+        std::scoped_lock<std::mutex> lock(postedTasksMutex);
+
+        postedTasks.push_back(task);
+
+        if (postedTasks.size() == 1 && wakeUpEventReceiver != nullptr) {
+            wakeUpEventReceiver->wakeUp();
+        }
+    }
+
+    bool EventLoop::hasPendingWork() const {
+        return pendingWorkCount > 0;
+    }
+
+    void EventLoop::addEventLoopInitializer(const std::function<int()>& eventLoops,
+                                            const std::function<bool()>& cpuAffinity,
+                                            const std::function<void()>& initializer) {
+        if (running || EventLoop::instance().eventLoopIndex > 0) {
+            VLOG(0) << "Event loops are already running: Served by the current event loop only";
+        } else {
+            eventLoopInitializers.push_back({eventLoops, cpuAffinity, initializer});
+        }
+    }
+
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays, modernize-avoid-c-arrays)
     void EventLoop::init(int argc, char* argv[]) {
         logger::Logger::setCustomFormatSpec("%tick", core::getTickCounterAsString);
 
         utils::Config::init(argc, argv);
 
+        EventLoop::instance().startWakeUp();
+        mainEventLoop = &EventLoop::instance();
+
         EventLoop::initialized = true;
     }
 
@@ -111,6 +173,9 @@ namespace core {
 
         utils::Config::prepare();
 
+        EventLoop::instance().eventMultiplexer.setBusyPollBudget(static_cast<double>(utils::Config::getBusyPoll()) / 1e6);
+        EventLoop::instance().eventMultiplexer.getWatchdog().setBudget(static_cast<double>(utils::Config::getWatchdog()) / 1e3);
+
         struct sigaction sact;
 
         sigemptyset(&sact.sa_mask);
@@ -121,7 +186,18 @@ namespace core {
         struct sigaction oldPipeAct;
         sigaction(SIGPIPE, &sact, &oldPipeAct);
 
-        sact.sa_handler = EventLoop::stoponsig;
+        // SIGINT, SIGTERM and SIGALRM are blocked while running and are received through a signalfd by the event loop itself
+        sigset_t stopSigSet;
+        sigemptyset(&stopSigSet);
+        sigaddset(&stopSigSet, SIGINT);
+        sigaddset(&stopSigSet, SIGTERM);
+        sigaddset(&stopSigSet, SIGALRM);
+
+        sigset_t oldSigSet;
+        core::system::pthread_sigmask(SIG_BLOCK, &stopSigSet, &oldSigSet);
+
+        // Ignored signals are discarded instead of being queued to the signalfd
+        sact.sa_handler = SIG_DFL;
 
         struct sigaction oldIntAct;
         sigaction(SIGINT, &sact, &oldIntAct);
@@ -136,6 +212,14 @@ namespace core {
             running = true;
             stopped = false;
 
+            // Only the outermost start() receives the stop signals
+            SignalEventReceiver* signalEventReceiver = new SignalEventReceiver(stopSigSet, EventLoop::stoponsig);
+            if (!signalEventReceiver->isEnabled()) {
+                delete signalEventReceiver;
+            }
+
+            startEventLoopThreads(timeOut);
+
             core::TickStatus tickStatus = TickStatus::SUCCESS;
 
             while (tickStatus == TickStatus::SUCCESS && !stopped) {
@@ -155,14 +239,17 @@ namespace core {
             }
 
             running = false;
+
+            stopEventLoopThreads();
         }
 
+        free();
+
         sigaction(SIGPIPE, &oldPipeAct, nullptr);
         sigaction(SIGINT, &oldIntAct, nullptr);
         sigaction(SIGTERM, &oldTermAct, nullptr);
         sigaction(SIGALRM, &oldAlarmAct, nullptr);
-
-        free();
+        core::system::pthread_sigmask(SIG_SETMASK, &oldSigSet, nullptr);
 
         int returnReason = 0;
         if (stopsig != 0) {
@@ -184,11 +271,57 @@ namespace core {
             tickStatus = EventLoop::instance()._tick(3);
         } while (tickStatus == TickStatus::SUCCESS);
 
-        DynamicLoader::execDlCloseAll();
+        EventLoop::instance().stopWakeUp();
+
+        if (EventLoop::instance().eventLoopIndex == 0) {
+            DynamicLoader::execDlCloseAll();
+
+            utils::Config::terminate();
+
+            LOG(INFO) << "All resources released";
+        }
+    }
+
+    void EventLoop::listenerAdded() {
+        listeners++;
+    }
 
-        utils::Config::terminate();
+    void EventLoop::listenerRemoved(bool handedOver) {
+        listeners--;
+
+        if (handedOver && !listenersHandedOver.exchange(true)) {
+            // The drain is supervised by the main event loop. It thus stays alive until the connections of all event loops are closed
+            if (EventLoop::instance().eventLoopIndex == 0) {
+                drainEventLoops();
+            } else if (mainEventLoop != nullptr) {
+                mainEventLoop->post(EventLoop::drainEventLoops);
+            }
+        }
+    }
 
-        LOG(INFO) << "All resources released";
+    void EventLoop::drainEventLoops() {
+        // Ends on its own once no connection is left in any event loop, stops after the drain timeout otherwise
+        core::timer::Timer::intervalTimer(
+            [draining = false, deadline = utils::Timeval()]([[maybe_unused]] const void* arg,
+                                                             const std::function<void()>& stopTimer) mutable -> void {
+                if (listeners == 0) {
+                    if (!draining) {
+                        LOG(INFO) << "All listening sockets handed over: Draining established connections";
+
+                        deadline = getCurrentTime() + HANDOVER_DRAIN_TIMEOUT;
+                        draining = true;
+                    }
+
+                    if (EventLoop::instance().eventMultiplexer.getObservedEventReceiverCount() == 0 && eventLoopThreadsRunning == 0) {
+                        stopTimer();
+                    } else if (getCurrentTime() >= deadline) {
+                        stopTimer();
+                        stop();
+                    }
+                }
+            },
+            0.1,
+            nullptr);
     }
 
     void EventLoop::stoponsig(int sig) {
@@ -196,4 +329,163 @@ namespace core {
         stop();
     }
 
+    void EventLoop::startEventLoopThreads(const utils::Timeval& timeOut) {
+        int eventLoops = 1;
+        for (EventLoopInitializer& eventLoopInitializer : eventLoopInitializers) {
+            eventLoopInitializer.count = eventLoopInitializer.eventLoops();
+            eventLoops = std::max(eventLoops, eventLoopInitializer.count);
+
+            if (eventLoopInitializer.count > 1) {
+                cpuAffinity = cpuAffinity || eventLoopInitializer.cpuAffinity();
+            }
+        }
+
+        if (eventLoops > 1) {
+            eventLoopThreadsStopped = false;
+
+            if (cpuAffinity) {
+                setCpuAffinity(0);
+            }
+
+            eventLoopThreadsRunning = eventLoops - 1;
+
+            for (int eventLoopIndex = 1; eventLoopIndex < eventLoops; eventLoopIndex++) {
+                eventLoopThreads.emplace_back(EventLoop::runEventLoopThread, eventLoopIndex, timeOut);
+            }
+
+            LOG(INFO) << "EventLoop: Started " << eventLoops - 1 << " additional event loop threads";
+        }
+    }
+
+    void EventLoop::stopEventLoopThreads() {
+        eventLoopThreadsStopped = true;
+
+        {
+            std::scoped_lock<std::mutex> lock(eventLoopsMutex);
+
+            for (EventLoop* eventLoop : eventLoops) {
+                eventLoop->wakeUp();
+            }
+        }
+
+        for (std::thread& eventLoopThread : eventLoopThreads) {
+            eventLoopThread.join();
+        }
+        eventLoopThreads.clear();
+        eventLoopInitializers.clear();
+    }
+
+    void EventLoop::runEventLoopThread(int eventLoopIndex, const utils::Timeval& timeOut) {
+        EventLoop& eventLoop = EventLoop::instance();
+        eventLoop.eventLoopIndex = eventLoopIndex;
+        eventLoop.eventMultiplexer.setBusyPollBudget(static_cast<double>(utils::Config::getBusyPoll()) / 1e6);
+        eventLoop.eventMultiplexer.getWatchdog().setBudget(static_cast<double>(utils::Config::getWatchdog()) / 1e3);
+
+        if (cpuAffinity) {
+            setCpuAffinity(eventLoopIndex);
+        }
+
+        // Signals stay blocked (inherited) in this thread, the stop request arrives through the wake up receiver
+        eventLoop.startWakeUp();
+        {
+            std::scoped_lock<std::mutex> lock(eventLoopsMutex);
+
+            eventLoops.push_back(&eventLoop);
+        }
+
+        for (const EventLoopInitializer& eventLoopInitializer : eventLoopInitializers) {
+            if (eventLoopIndex < eventLoopInitializer.count) {
+                eventLoopInitializer.initializer();
+            }
+        }
+
+        running = true;
+        stopped = false;
+
+        core::TickStatus tickStatus = TickStatus::SUCCESS;
+        while (tickStatus == TickStatus::SUCCESS && !stopped && !eventLoopThreadsStopped) {
+            tickStatus = eventLoop._tick(timeOut);
+        }
+
+        if (tickStatus == TickStatus::ERROR) {
+            PLOG(ERROR) << "EventLoop " << eventLoopIndex << ": EventPublisher::publish()";
+        }
+
+        running = false;
+        eventLoopThreadsRunning--;
+
+        {
+            std::scoped_lock<std::mutex> lock(eventLoopsMutex);
+
+            std::erase(eventLoops, &eventLoop);
+        }
+
+        free();
+    }
+
+    void EventLoop::startWakeUp() {
+        WakeUpEventReceiver* newWakeUpEventReceiver = new WakeUpEventReceiver([this]() -> void {
+            executePostedTasks();
+        });
+
+        if (newWakeUpEventReceiver->isEnabled()) {
+            std::scoped_lock<std::mutex> lock(postedTasksMutex);
+
+            wakeUpEventReceiver = newWakeUpEventReceiver;
+            if (!postedTasks.empty()) {
+                wakeUpEventReceiver->wakeUp();
+            }
+        } else {
+            delete newWakeUpEventReceiver;
+        }
+    }
+
+    void EventLoop::stopWakeUp() {
+        WakeUpEventReceiver* oldWakeUpEventReceiver = nullptr;
+        {
+            std::scoped_lock<std::mutex> lock(postedTasksMutex);
+
+            oldWakeUpEventReceiver = wakeUpEventReceiver;
+            wakeUpEventReceiver = nullptr;
+        }
+
+        if (oldWakeUpEventReceiver != nullptr) {
+            oldWakeUpEventReceiver->disable();
+            _tick(0); // release it
+        }
+    }
+
+    void EventLoop::wakeUp() {
+        std::scoped_lock<std::mutex> lock(postedTasksMutex);
+
+        if (wakeUpEventReceiver != nullptr) {
+            wakeUpEventReceiver->wakeUp();
+        }
+    }
+
+    void EventLoop::executePostedTasks() {
+        std::vector<std::function<void()>> tasks;
+        {
+            std::scoped_lock<std::mutex> lock(postedTasksMutex);
+
+            tasks.swap(postedTasks);
+        }
+
+        for (const std::function<void()>& task : tasks) {
+            task();
+        }
+    }
+
+    void EventLoop::setCpuAffinity(int eventLoopIndex) {
+        unsigned int cpus = std::max(std::thread::hardware_concurrency(), 1U);
+
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(static_cast<unsigned int>(eventLoopIndex) % cpus, &cpuSet);
+
+        if (core::system::pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) < 0) {
+            PLOG(WARNING) << "EventLoop " << eventLoopIndex << ": pthread_setaffinity_np";
+        }
+    }
+
 } // namespace core
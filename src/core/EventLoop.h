@@ -23,12 +23,19 @@
 
 namespace core {
     class EventMultiplexer;
+    class WakeUpEventReceiver;
 } // namespace core
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
 #include "utils/Timeval.h"
 
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
 namespace core {
@@ -43,11 +50,34 @@ namespace core {
         ~EventLoop() = default;
 
     public:
+        // Each thread running an event loop has its own instance
         static EventLoop& instance();
 
         static unsigned long getTickCounter();
+        static utils::Timeval getCurrentTime();
+        static bool isStopPending();
         EventMultiplexer& getEventMultiplexer();
 
+        // 0 for the event loop of SNodeC::start(), 1 .. n - 1 for the additional event loop threads
+        static int getEventLoopIndex();
+
+        // Thread safe: task is executed by this event loop in its own thread during one of its next ticks
+        void post(const std::function<void()>& task);
+
+        // Work submitted from this event loop to a ThreadPool whose completion has not yet been executed keeps it alive
+        bool hasPendingWork() const;
+
+        // Runs initializer in the additional event loops 1 .. eventLoops() - 1 once SNodeC::start() has started their threads.
+        // eventLoops and cpuAffinity are queried at start, i.e. after the configuration has been parsed.
+        static void addEventLoopInitializer(const std::function<int()>& eventLoops,
+                                            const std::function<bool()>& cpuAffinity,
+                                            const std::function<void()>& initializer);
+
+        // Listening sockets of this process. Once all of them have been handed over to a restarted instance (see --restart) the
+        // established connections are drained: the process ends when they are closed or is stopped after a drain timeout
+        static void listenerAdded();
+        static void listenerRemoved(bool handedOver);
+
     private:
         // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays, modernize-avoid-c-arrays)
         static void init(int argc, char* argv[]);
@@ -59,17 +89,57 @@ namespace core {
 
         static void stoponsig(int sig);
 
+        static void startEventLoopThreads(const utils::Timeval& timeOut);
+        static void stopEventLoopThreads();
+        static void runEventLoopThread(int eventLoopIndex, const utils::Timeval& timeOut);
+        static void drainEventLoops();
+        static void setCpuAffinity(int eventLoopIndex);
+
+        void startWakeUp();
+        void stopWakeUp();
+        void wakeUp();
+        void executePostedTasks();
+
         core::EventMultiplexer& eventMultiplexer;
 
+        int eventLoopIndex = 0;
+
+        std::mutex postedTasksMutex;
+        std::vector<std::function<void()>> postedTasks;
+        WakeUpEventReceiver* wakeUpEventReceiver = nullptr;
+
+        int pendingWorkCount = 0;
+
     private:
-        static bool running;
-        static bool stopped;
+        static thread_local bool running;
+        static thread_local bool stopped;
         static int stopsig;
         static bool initialized;
 
-        static unsigned long tickCounter;
+        static thread_local unsigned long tickCounter;
+
+        struct EventLoopInitializer {
+            std::function<int()> eventLoops;
+            std::function<bool()> cpuAffinity;
+            std::function<void()> initializer;
+            int count = 1;
+        };
+
+        static std::vector<EventLoopInitializer> eventLoopInitializers;
+        static bool cpuAffinity;
+
+        static std::vector<std::thread> eventLoopThreads;
+        static std::atomic<bool> eventLoopThreadsStopped;
+        static std::mutex eventLoopsMutex;
+        static std::vector<EventLoop*> eventLoops;
+        static std::atomic<int> eventLoopThreadsRunning;
+        static EventLoop* mainEventLoop;
+
+        static std::atomic<int> listeners;
+        static std::atomic<bool> listenersHandedOver;
 
         friend class SNodeC;
+        friend class ThreadPool;
     };
 
 } // namespace core
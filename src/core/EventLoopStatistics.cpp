@@ -0,0 +1,82 @@
+/*
+ * snode.c - a slim toolkit for network communication
+ * Copyright (C) 2020, 2021, 2022 Volker Christian <me@vchrist.at>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/EventLoopStatistics.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <algorithm>
+#include <bit>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core {
+
+    void Histogram::add(unsigned long value) {
+        buckets[std::min(static_cast<std::size_t>(std::bit_width(value)), BUCKETS - 1)]++;
+
+        count++;
+        sum += value;
+        max = std::max(max, value);
+    }
+
+    void Histogram::reset() {
+        buckets.fill(0);
+        count = 0;
+        sum = 0;
+        max = 0;
+    }
+
+    unsigned long Histogram::getCount() const {
+        return count;
+    }
+
+    unsigned long Histogram::getSum() const {
+        return sum;
+    }
+
+    unsigned long Histogram::getMax() const {
+        return max;
+    }
+
+    double Histogram::getMean() const {
+        return count > 0 ? static_cast<double>(sum) / static_cast<double>(count) : 0;
+    }
+
+    unsigned long Histogram::getPercentile(double p) const {
+        unsigned long rank = static_cast<unsigned long>(p * static_cast<double>(count));
+        unsigned long percentile = 0;
+
+        unsigned long seen = 0;
+        for (std::size_t bucket = 0; bucket < BUCKETS; bucket++) {
+            seen += buckets[bucket];
+
+            if (seen > rank || seen == count) {
+                percentile = bucket == 0 ? 0 : std::min((1UL << bucket) - 1, max);
+                break;
+            }
+        }
+
+        return percentile;
+    }
+
+    const std::array<unsigned long, Histogram::BUCKETS>& Histogram::getBuckets() const {
+        return buckets;
+    }
+
+} // namespace core
@@ -0,0 +1,73 @@
+/*
+ * snode.c - a slim toolkit for network communication
+ * Copyright (C) 2020, 2021, 2022 Volker Christian <me@vchrist.at>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CORE_EVENTLOOPSTATISTICS_H
+#define CORE_EVENTLOOPSTATISTICS_H
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <array>
+#include <cstddef>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core {
+
+    // Power of two histogram: bucket 0 counts the value 0, bucket i values in [2^(i - 1), 2^i)
+    class Histogram {
+    public:
+        static constexpr std::size_t BUCKETS = 32;
+
+        void add(unsigned long value);
+        void reset();
+
+        unsigned long getCount() const;
+        unsigned long getSum() const;
+        unsigned long getMax() const;
+        double getMean() const;
+
+        // Upper bound of the bucket containing the p-quantile (0 <= p <= 1)
+        unsigned long getPercentile(double p) const;
+
+        const std::array<unsigned long, BUCKETS>& getBuckets() const;
+
+    private:
+        std::array<unsigned long, BUCKETS> buckets{};
+        unsigned long count = 0;
+        unsigned long sum = 0;
+        unsigned long max = 0;
+    };
+
+    // Instrumentation of one event loop, collected only while enabled by SNodeC::setStatisticsEnabled()
+    struct EventLoopStatistics {
+        unsigned long ticks = 0;
+
+        Histogram multiplexTime;  // us blocked in multiplex()
+        Histogram dispatchTime;   // us spent dispatching events and timers, i.e. in callbacks
+        Histogram eventsPerTick;  // events executed per tick
+
+        // Filled on query
+        std::array<int, 3> observedEventReceivers{};   // READ, WRITE, EXCEPT
+        std::array<unsigned long, 3> publishedEvents{}; // READ, WRITE, EXCEPT
+        std::size_t queuedEvents = 0;
+        bool enabled = false;
+    };
+
+} // namespace core
+
+#endif // CORE_EVENTLOOPSTATISTICS_H
@@ -21,6 +21,7 @@
 #include "core/DescriptorEventPublisher.h"
 #include "core/DynamicLoader.h"
 #include "core/Event.h"
+#include "core/EventLoop.h"
 #include "core/TimerEventPublisher.h"
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -28,12 +29,18 @@
 #include <algorithm>
 #include <cerrno>
 #include <numeric>
-#include <utility>
+#include <string>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
 namespace core {
 
+    std::atomic<bool> EventMultiplexer::statisticsEnabled = false;
+
+    static unsigned long toMicroSeconds(const utils::Timeval& timeVal) {
+        return timeVal > 0 ? static_cast<unsigned long>(timeVal.msd() * 1'000.) : 0;
+    }
+
     core::EventMultiplexer::EventMultiplexer(DescriptorEventPublisher* const readDescriptorEventPublisher,
                                              DescriptorEventPublisher* const writeDescriptorEventPublisher,
                                              DescriptorEventPublisher* const exceptionDescriptorEventPublisher)
@@ -85,18 +92,41 @@ namespace core {
     TickStatus EventMultiplexer::tick(const utils::Timeval& tickTimeOut) {
         TickStatus tickStatus = TickStatus::SUCCESS;
 
-        utils::Timeval currentTime = utils::Timeval::currentTime();
+        currentTime = utils::Timeval::currentTime();
+        currentTimeCached = true;
 
         publishActiveEvents(currentTime);
-        executeEventQueue(currentTime);
+        std::size_t executedEvents = executeEventQueue(currentTime);
         checkTimedOutEvents(currentTime);
         releaseExpiredResources(currentTime);
 
-        if (getObservedEventReceiverCount() > 0 || !timerEventPublisher->empty() || !eventQueue.empty()) {
+        currentTimeCached = false;
+
+        bool collectStatistics = statisticsEnabled.load(std::memory_order_relaxed);
+        utils::Timeval dispatchedTime;
+        if (collectStatistics) {
+            dispatchedTime = utils::Timeval::currentTime();
+
+            statistics.ticks++;
+            statistics.dispatchTime.add(toMicroSeconds(dispatchedTime - currentTime));
+            statistics.eventsPerTick.add(executedEvents);
+        }
+
+        if (getObservedEventReceiverCount() > 0 || !timerEventPublisher->empty() || !eventQueue.empty() ||
+            EventLoop::instance().hasPendingWork()) {
             utils::Timeval nextTimeout = std::min(getNextTimeout(currentTime), tickTimeOut);
+            if (EventLoop::isStopPending()) { // stop requested by a dispatched event or signal: do not block in multiplex
+                nextTimeout = 0;
+            } else {
+                nextTimeout = getMultiplexTimeout(currentTime, nextTimeout);
+            }
 
             activeEventCount = multiplex(nextTimeout);
 
+            if (collectStatistics) {
+                statistics.multiplexTime.add(toMicroSeconds(utils::Timeval::currentTime() - dispatchedTime));
+            }
+
             if (activeEventCount < 0 && errno != EINTR) {
                 tickStatus = TickStatus::ERROR;
             }
@@ -107,6 +137,49 @@ namespace core {
         return tickStatus;
     }
 
+    utils::Timeval EventMultiplexer::getCurrentTime() const {
+        return currentTimeCached ? currentTime : utils::Timeval::currentTime();
+    }
+
+    void EventMultiplexer::setStatisticsEnabled(bool statisticsEnabled) {
+        EventMultiplexer::statisticsEnabled = statisticsEnabled;
+    }
+
+    EventLoopStatistics EventMultiplexer::getStatistics() const {
+        EventLoopStatistics eventLoopStatistics = statistics;
+
+        for (std::size_t dispType = 0; dispType < DISP_COUNT; dispType++) {
+            eventLoopStatistics.observedEventReceivers[dispType] = descriptorEventPublishers[dispType]->getObservedEventReceiverCount();
+            eventLoopStatistics.publishedEvents[dispType] = descriptorEventPublishers[dispType]->getEventCounter();
+        }
+        eventLoopStatistics.queuedEvents = eventQueue.size();
+        eventLoopStatistics.enabled = statisticsEnabled;
+
+        return eventLoopStatistics;
+    }
+
+    void EventMultiplexer::resetStatistics() {
+        statistics = EventLoopStatistics();
+    }
+
+    Watchdog& EventMultiplexer::getWatchdog() {
+        return watchdog;
+    }
+
+    void EventMultiplexer::setBusyPollBudget(const utils::Timeval& busyPollBudget) {
+        this->busyPollBudget = busyPollBudget;
+    }
+
+    utils::Timeval EventMultiplexer::getMultiplexTimeout(const utils::Timeval& currentTime, const utils::Timeval& nextTimeout) {
+        utils::Timeval multiplexTimeout = nextTimeout;
+
+        if (busyPollBudget > 0 && currentTime - lastActiveTime < busyPollBudget) {
+            multiplexTimeout = 0;
+        }
+
+        return multiplexTimeout;
+    }
+
     void EventMultiplexer::stop() {
         for (DescriptorEventPublisher* const descriptorEventPublisher : descriptorEventPublishers) {
             descriptorEventPublisher->stop();
@@ -139,6 +212,11 @@ namespace core {
     void EventMultiplexer::publishActiveEvents(const utils::Timeval& currentTime) {
         timerEventPublisher->publishActiveEvents(currentTime);
         publishActiveEvents();
+
+        if (activeEventCount > 0) {
+            lastActiveTime = currentTime; // First tick after multiplex() returned: close to the arrival of the events
+        }
+        activeEventCount = 0; // Consumed: a tick which does not multiplex must not publish them again
     }
 
     void EventMultiplexer::releaseExpiredResources(const utils::Timeval& currentTime) {
@@ -149,49 +227,74 @@ namespace core {
         DynamicLoader::execDlCloseDeleyed();
     }
 
-    void EventMultiplexer::executeEventQueue(const utils::Timeval& currentTime) {
-        eventQueue.execute(currentTime);
+    std::size_t EventMultiplexer::executeEventQueue(const utils::Timeval& currentTime) {
+        return eventQueue.execute(currentTime, watchdog);
     }
 
-    EventMultiplexer::EventQueue::EventQueue()
-        : executeQueue(new std::list<Event*>())
-        , publishQueue(new std::list<Event*>()) {
-        sigemptyset(&newSet);
-        sigaddset(&newSet, SIGPIPE);
-        sigaddset(&newSet, SIGINT);
-        sigaddset(&newSet, SIGTERM);
-        sigaddset(&newSet, SIGALRM);
-    }
+    void EventMultiplexer::EventQueue::insert(Event* event) {
+        event->nextEvent = nullptr;
+        event->prevNextEvent = publishTail;
 
-    EventMultiplexer::EventQueue::~EventQueue() {
-        delete executeQueue;
-        delete publishQueue;
-    }
+        *publishTail = event;
+        publishTail = &event->nextEvent;
 
-    void EventMultiplexer::EventQueue::insert(Event* event) {
-        publishQueue->push_back(event); // do not allow two or more same events in one tick
+        count++;
     }
 
     void EventMultiplexer::EventQueue::remove(Event* event) {
-        publishQueue->remove(event); // in case of erase remove the event from the published queue
-    }
+        if (event->prevNextEvent != nullptr) { // in case of erase remove the event from the published or the executing queue
+            *event->prevNextEvent = event->nextEvent;
 
-    void EventMultiplexer::EventQueue::execute(const utils::Timeval& currentTime) {
-        std::swap(executeQueue, publishQueue);
+            if (event->nextEvent != nullptr) {
+                event->nextEvent->prevNextEvent = event->prevNextEvent;
+            } else if (publishTail == &event->nextEvent) {
+                publishTail = event->prevNextEvent;
+            }
 
-        sigprocmask(SIG_BLOCK, &newSet, &oldSet);
+            event->nextEvent = nullptr;
+            event->prevNextEvent = nullptr;
 
-        for (Event* event : *executeQueue) {
-            event->dispatch(currentTime);
+            count--;
         }
+    }
+
+    std::size_t EventMultiplexer::EventQueue::execute(const utils::Timeval& currentTime, Watchdog& watchdog) {
+        std::size_t executed = 0;
+
+        executeHead = publishHead;
+        if (executeHead != nullptr) {
+            executeHead->prevNextEvent = &executeHead;
+        }
+
+        publishHead = nullptr;
+        publishTail = &publishHead;
+
+        while (executeHead != nullptr) {
+            Event* event = executeHead;
+            remove(event);
 
-        sigprocmask(SIG_SETMASK, &oldSet, &newSet);
+            if (watchdog.isEnabled()) {
+                std::string name = event->getName(); // the event may be gone after its dispatch
+                utils::Timeval start = utils::Timeval::currentTime();
 
-        executeQueue->clear();
+                event->dispatch(currentTime);
+
+                watchdog.check(name, start);
+            } else {
+                event->dispatch(currentTime);
+            }
+            executed++;
+        }
+
+        return executed;
     }
 
     bool EventMultiplexer::EventQueue::empty() const {
-        return publishQueue->empty();
+        return publishHead == nullptr;
+    }
+
+    std::size_t EventMultiplexer::EventQueue::size() const {
+        return count;
     }
 
 } // namespace core
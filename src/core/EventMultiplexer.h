@@ -20,7 +20,9 @@
 #define CORE_EVENTMULTIPLEXER_H
 
 #include "core/DescriptorEventReceiver.h" // IWYU pragma: export
+#include "core/EventLoopStatistics.h"     // IWYU pragma: export
 #include "core/TickStatus.h"              // IWYU pragma: export
+#include "core/Watchdog.h"                // IWYU pragma: export
 
 namespace core {
     class Event;
@@ -34,10 +36,9 @@ namespace utils {
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
-#include "core/system/signal.h"
-
 #include <array> // IWYU pragma: export
-#include <list>
+#include <atomic>
+#include <cstddef>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
@@ -55,22 +56,27 @@ namespace core {
         virtual ~EventMultiplexer();
 
     private:
+        // Intrusive FIFO of published events linked via Event::nextEvent: no allocation on publish and O(1) unpublish
         class EventQueue {
         public:
-            EventQueue();
-            ~EventQueue();
+            EventQueue() = default;
+
+            EventQueue(const EventQueue&) = delete;
+            EventQueue& operator=(const EventQueue&) = delete;
 
             void insert(Event* event);
             void remove(Event* event);
-            void execute(const utils::Timeval& currentTime);
+            std::size_t execute(const utils::Timeval& currentTime, Watchdog& watchdog);
             bool empty() const;
+            std::size_t size() const;
 
         private:
-            std::list<Event*>* executeQueue;
-            std::list<Event*>* publishQueue;
+            Event* executeHead = nullptr;
 
-            sigset_t newSet;
-            sigset_t oldSet;
+            Event* publishHead = nullptr;
+            Event** publishTail = &publishHead;
+
+            std::size_t count = 0;
         };
 
     public:
@@ -85,10 +91,28 @@ namespace core {
         TickStatus tick(const utils::Timeval& tickTimeOut);
         void stop();
 
-    protected:
+        // Read once per tick: all deadlines of one tick are based on the same time. Outside of a tick the clock is read directly
+        utils::Timeval getCurrentTime() const;
+
+        // Near zero overhead while disabled: one relaxed atomic load per tick
+        static void setStatisticsEnabled(bool statisticsEnabled);
+        EventLoopStatistics getStatistics() const;
+        void resetStatistics();
+
+        Watchdog& getWatchdog();
+
+        // Busy polling: multiplex() does not block while the last active event is less than busyPollBudget ago. 0 disables it
+        void setBusyPollBudget(const utils::Timeval& busyPollBudget);
+
+        // Descriptor event receivers keeping the event loop alive
         int getObservedEventReceiverCount();
+
+    protected:
         int getMaxFd();
 
+        // Policy hook: the timeout finally passed to multiplex(). nextTimeout is the time until the next due timer or inactivity timeout
+        virtual utils::Timeval getMultiplexTimeout(const utils::Timeval& currentTime, const utils::Timeval& nextTimeout);
+
     private:
         void checkTimedOutEvents(const utils::Timeval& currentTime);
 
@@ -98,7 +122,7 @@ namespace core {
         void publishActiveEvents(const utils::Timeval& currentTime);
         virtual void publishActiveEvents() = 0;
         void releaseExpiredResources(const utils::Timeval& currentTime);
-        void executeEventQueue(const utils::Timeval& currentTime);
+        std::size_t executeEventQueue(const utils::Timeval& currentTime);
 
     protected:
         std::array<DescriptorEventPublisher*, DISP_COUNT> descriptorEventPublishers;
@@ -109,6 +133,17 @@ namespace core {
     private:
         EventQueue eventQueue;
 
+        utils::Timeval currentTime;
+        bool currentTimeCached = false;
+
+        utils::Timeval busyPollBudget;
+        utils::Timeval lastActiveTime;
+
+        Watchdog watchdog;
+
+        EventLoopStatistics statistics;
+        static std::atomic<bool> statisticsEnabled;
+
         friend class DescriptorEventPublisher;
     };
 
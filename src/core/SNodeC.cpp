@@ -19,6 +19,7 @@
 #include "core/SNodeC.h"
 
 #include "core/EventLoop.h"
+#include "core/EventMultiplexer.h"
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
@@ -46,4 +47,46 @@ namespace core {
         EventLoop::free();
     }
 
+    void SNodeC::addEventLoopInitializer(const std::function<int()>& eventLoops,
+                                         const std::function<bool()>& cpuAffinity,
+                                         const std::function<void()>& initializer) {
+        EventLoop::addEventLoopInitializer(eventLoops, cpuAffinity, initializer);
+    }
+
+    int SNodeC::getEventLoopIndex() {
+        return EventLoop::getEventLoopIndex();
+    }
+
+    utils::Timeval SNodeC::getCurrentTime() {
+        return EventLoop::getCurrentTime();
+    }
+
+    void SNodeC::setStatisticsEnabled(bool statisticsEnabled) {
+        EventMultiplexer::setStatisticsEnabled(statisticsEnabled);
+    }
+
+    EventLoopStatistics SNodeC::getStatistics() {
+        return EventLoop::instance().getEventMultiplexer().getStatistics();
+    }
+
+    void SNodeC::resetStatistics() {
+        EventLoop::instance().getEventMultiplexer().resetStatistics();
+    }
+
+    std::vector<Watchdog::Record> SNodeC::getSlowCallbacks() {
+        return EventLoop::instance().getEventMultiplexer().getWatchdog().getWorstOffenders();
+    }
+
+    void SNodeC::resetSlowCallbacks() {
+        EventLoop::instance().getEventMultiplexer().getWatchdog().reset();
+    }
+
+    EventLoop& SNodeC::getEventLoop() {
+        return EventLoop::instance();
+    }
+
+    void SNodeC::post(EventLoop& eventLoop, const std::function<void()>& task) {
+        eventLoop.post(task);
+    }
+
 } // namespace core
@@ -19,13 +19,21 @@
 #ifndef CORE_SNODEC_H
 #define CORE_SNODEC_H
 
-#include "core/TickStatus.h" // IWYU pragma: export
+#include "core/EventLoopStatistics.h" // IWYU pragma: export
+#include "core/TickStatus.h"          // IWYU pragma: export
+#include "core/Watchdog.h"            // IWYU pragma: export
+
+namespace core {
+    class EventLoop;
+} // namespace core
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
 #include "utils/Timeval.h"
 
 #include <climits>
+#include <functional>
+#include <vector>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
@@ -44,6 +52,28 @@ namespace core {
         static void stop();
         static TickStatus tick(const utils::Timeval& timeOut = 0);
         static void free();
+
+        // Runs initializer in each additional event loop thread 1 .. eventLoops() - 1 started by start()
+        static void addEventLoopInitializer(const std::function<int()>& eventLoops,
+                                            const std::function<bool()>& cpuAffinity,
+                                            const std::function<void()>& initializer);
+        static int getEventLoopIndex();
+
+        // Monotonic time of the current tick of the calling thread's event loop
+        static utils::Timeval getCurrentTime();
+
+        // Instrumentation of all event loops. getStatistics() and resetStatistics() refer to the calling thread's event loop
+        static void setStatisticsEnabled(bool statisticsEnabled);
+        static EventLoopStatistics getStatistics();
+        static void resetStatistics();
+
+        // Dispatches of the calling thread's event loop which exceeded the --watchdog budget
+        static std::vector<Watchdog::Record> getSlowCallbacks();
+        static void resetSlowCallbacks();
+
+        // The event loop of the calling thread. post() may be called from any thread, task runs in the thread of eventLoop
+        static EventLoop& getEventLoop();
+        static void post(EventLoop& eventLoop, const std::function<void()>& task);
     };
 
 } // namespace core
@@ -0,0 +1,62 @@
+/*
+ * snode.c - a slim toolkit for network communication
+ * Copyright (C) 2020, 2021, 2022 Volker Christian <me@vchrist.at>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/SignalEventReceiver.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include "core/system/unistd.h"
+#include "log/Logger.h"
+
+#include <cerrno>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core {
+
+    SignalEventReceiver::SignalEventReceiver(const sigset_t& sigSet, const std::function<void(int)>& onSignal)
+        : core::eventreceiver::ReadEventReceiver("SignalEventReceiver", core::DescriptorEventReceiver::TIMEOUT::DISABLE)
+        , onSignal(onSignal) {
+        setKeepEventLoopAlive(false);
+
+        if (open(core::system::signalfd(-1, &sigSet, SFD_NONBLOCK | SFD_CLOEXEC)) >= 0) {
+            enable(getFd());
+        } else {
+            PLOG(ERROR) << "signalfd";
+        }
+    }
+
+    void SignalEventReceiver::readEvent() {
+        signalfd_siginfo sigInfo{};
+
+        ssize_t ret = 0;
+        while ((ret = core::system::read(getFd(), &sigInfo, sizeof(sigInfo))) == static_cast<ssize_t>(sizeof(sigInfo))) {
+            onSignal(static_cast<int>(sigInfo.ssi_signo));
+        }
+
+        if (ret < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+            PLOG(ERROR) << "SignalEventReceiver: read";
+            disable();
+        }
+    }
+
+    void SignalEventReceiver::unobservedEvent() {
+        delete this;
+    }
+
+} // namespace core
@@ -0,0 +1,55 @@
+/*
+ * snode.c - a slim toolkit for network communication
+ * Copyright (C) 2020, 2021, 2022 Volker Christian <me@vchrist.at>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CORE_SIGNALEVENTRECEIVER_H
+#define CORE_SIGNALEVENTRECEIVER_H
+
+#include "core/Descriptor.h"
+#include "core/eventreceiver/ReadEventReceiver.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include "core/system/signal.h" // IWYU pragma: export
+
+#include <functional>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core {
+
+    // Delivers the signals of sigSet through a signalfd observed by the event loop. The signals must be blocked by the caller.
+    class SignalEventReceiver
+        : public core::eventreceiver::ReadEventReceiver
+        , public core::Descriptor {
+        SignalEventReceiver(const SignalEventReceiver&) = delete;
+        SignalEventReceiver& operator=(const SignalEventReceiver&) = delete;
+
+    public:
+        SignalEventReceiver(const sigset_t& sigSet, const std::function<void(int)>& onSignal);
+        ~SignalEventReceiver() override = default;
+
+    private:
+        void readEvent() override;
+        void unobservedEvent() override;
+
+        std::function<void(int)> onSignal;
+    };
+
+} // namespace core
+
+#endif // CORE_SIGNALEVENTRECEIVER_H
@@ -0,0 +1,119 @@
+/*
+ * snode.c - a slim toolkit for network communication
+ * Copyright (C) 2020, 2021, 2022 Volker Christian <me@vchrist.at>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/ThreadPool.h"
+
+#include "core/EventLoop.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include "core/system/signal.h"
+#include "log/Logger.h"
+
+#include <algorithm>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core {
+
+    ThreadPool::ThreadPool(unsigned int threads) {
+        threads = std::max(threads, 1U);
+
+        for (unsigned int i = 0; i < threads; i++) {
+            workers.emplace_back(&ThreadPool::run, this);
+        }
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            std::scoped_lock<std::mutex> lock(jobsMutex);
+
+            stopped = true;
+        }
+        jobsCondition.notify_all();
+
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+    }
+
+    ThreadPool& ThreadPool::instance() {
+        static ThreadPool threadPool;
+
+        return threadPool;
+    }
+
+    void ThreadPool::submit(const std::function<void()>& work, const std::function<void(std::exception_ptr)>& onDone) {
+        EventLoop& eventLoop = EventLoop::instance();
+        eventLoop.pendingWorkCount++;
+
+        {
+            std::scoped_lock<std::mutex> lock(jobsMutex);
+
+            jobs.push_back({work, onDone, &eventLoop});
+        }
+        jobsCondition.notify_one();
+    }
+
+    std::size_t ThreadPool::getThreadCount() const {
+        return workers.size();
+    }
+
+    void ThreadPool::run() {
+        // Process directed signals must be received by the event loops only
+        sigset_t sigSet;
+        sigfillset(&sigSet);
+        core::system::pthread_sigmask(SIG_BLOCK, &sigSet, nullptr);
+
+        for (;;) {
+            Job job;
+            {
+                std::unique_lock<std::mutex> lock(jobsMutex);
+
+                jobsCondition.wait(lock, [this]() -> bool {
+                    return stopped || !jobs.empty();
+                });
+
+                if (jobs.empty()) {
+                    break;
+                }
+
+                job = std::move(jobs.front());
+                jobs.pop_front();
+            }
+
+            std::exception_ptr error = nullptr;
+            try {
+                job.work();
+            } catch (...) {
+                error = std::current_exception();
+            }
+
+            job.eventLoop->post([onDone = std::move(job.onDone), error]() -> void {
+                EventLoop::instance().pendingWorkCount--;
+
+                if (onDone) {
+                    onDone(error);
+                } else if (error != nullptr) {
+                    LOG(WARNING) << "ThreadPool: Work terminated by an exception";
+                }
+            });
+        }
+    }
+
+} // namespace core
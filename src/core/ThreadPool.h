@@ -0,0 +1,78 @@
+/*
+ * snode.c - a slim toolkit for network communication
+ * Copyright (C) 2020, 2021, 2022 Volker Christian <me@vchrist.at>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CORE_THREADPOOL_H
+#define CORE_THREADPOOL_H
+
+namespace core {
+    class EventLoop;
+} // namespace core
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core {
+
+    // Runs CPU heavy work off the event loop. Completion callbacks are executed by the event loop which submitted the work, thus
+    // handlers keep their single threaded semantics. That event loop keeps running until all of its completions are executed.
+    class ThreadPool {
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+    public:
+        explicit ThreadPool(unsigned int threads = std::thread::hardware_concurrency());
+        ~ThreadPool();
+
+        // Shared pool, created on first use
+        static ThreadPool& instance();
+
+        // Must be called from an event loop thread. work runs in a worker thread, onDone afterwards in the submitting event loop.
+        // onDone receives the exception thrown by work, or nullptr
+        void submit(const std::function<void()>& work, const std::function<void(std::exception_ptr)>& onDone = nullptr);
+
+        std::size_t getThreadCount() const;
+
+    private:
+        void run();
+
+        struct Job {
+            std::function<void()> work;
+            std::function<void(std::exception_ptr)> onDone;
+            EventLoop* eventLoop = nullptr;
+        };
+
+        std::mutex jobsMutex;
+        std::condition_variable jobsCondition;
+        std::deque<Job> jobs;
+        bool stopped = false;
+
+        std::vector<std::thread> workers;
+    };
+
+} // namespace core
+
+#endif // CORE_THREADPOOL_H
@@ -34,7 +34,7 @@ namespace core {
     TimerEventReceiver::TimerEventReceiver(const std::string& name, const utils::Timeval& delay)
         : EventReceiver(name)
         , timerEventPublisher(EventLoop::instance().getEventMultiplexer().getTimerEventPublisher())
-        , absoluteTimeout(utils::Timeval::currentTime() + delay)
+        , absoluteTimeout(EventLoop::getCurrentTime() + delay)
         , delay(delay) {
     }
 
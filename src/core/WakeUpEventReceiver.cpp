@@ -0,0 +1,68 @@
+/*
+ * snode.c - a slim toolkit for network communication
+ * Copyright (C) 2020, 2021, 2022 Volker Christian <me@vchrist.at>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/WakeUpEventReceiver.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include "core/system/eventfd.h"
+#include "log/Logger.h"
+
+#include <cerrno>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core {
+
+    WakeUpEventReceiver::WakeUpEventReceiver(const std::function<void()>& onWakeUp)
+        : core::eventreceiver::ReadEventReceiver("WakeUpEventReceiver", core::DescriptorEventReceiver::TIMEOUT::DISABLE)
+        , onWakeUp(onWakeUp) {
+        setKeepEventLoopAlive(false);
+
+        if (open(core::system::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) >= 0) {
+            enable(getFd());
+        } else {
+            PLOG(ERROR) << "eventfd";
+        }
+    }
+
+    void WakeUpEventReceiver::wakeUp() {
+        if (core::system::eventfd_write(getFd(), 1) < 0 && errno != EAGAIN) {
+            PLOG(ERROR) << "WakeUpEventReceiver: eventfd_write";
+        }
+    }
+
+    void WakeUpEventReceiver::terminate() {
+    }
+
+    void WakeUpEventReceiver::readEvent() {
+        eventfd_t value = 0;
+
+        if (core::system::eventfd_read(getFd(), &value) == 0) {
+            onWakeUp();
+        } else if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+            PLOG(ERROR) << "WakeUpEventReceiver: eventfd_read";
+            disable();
+        }
+    }
+
+    void WakeUpEventReceiver::unobservedEvent() {
+        delete this;
+    }
+
+} // namespace core
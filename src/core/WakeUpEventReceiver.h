@@ -0,0 +1,58 @@
+/*
+ * snode.c - a slim toolkit for network communication
+ * Copyright (C) 2020, 2021, 2022 Volker Christian <me@vchrist.at>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CORE_WAKEUPEVENTRECEIVER_H
+#define CORE_WAKEUPEVENTRECEIVER_H
+
+#include "core/Descriptor.h"
+#include "core/eventreceiver/ReadEventReceiver.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <functional>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core {
+
+    // Wakes up the event loop observing it from any thread through an eventfd
+    class WakeUpEventReceiver
+        : public core::eventreceiver::ReadEventReceiver
+        , public core::Descriptor {
+        WakeUpEventReceiver(const WakeUpEventReceiver&) = delete;
+        WakeUpEventReceiver& operator=(const WakeUpEventReceiver&) = delete;
+
+    public:
+        explicit WakeUpEventReceiver(const std::function<void()>& onWakeUp);
+        ~WakeUpEventReceiver() override = default;
+
+        void wakeUp();
+
+        // Stays observed until its owner disables it: posted tasks must still be delivered while the event loop shuts down
+        void terminate() override;
+
+    private:
+        void readEvent() override;
+        void unobservedEvent() override;
+
+        std::function<void()> onWakeUp;
+    };
+
+} // namespace core
+
+#endif // CORE_WAKEUPEVENTRECEIVER_H
@@ -0,0 +1,81 @@
+/*
+ * snode.c - a slim toolkit for network communication
+ * Copyright (C) 2020, 2021, 2022 Volker Christian <me@vchrist.at>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/Watchdog.h"
+
+#include "core/EventLoop.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include "log/Logger.h"
+
+#include <algorithm>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core {
+
+    void Watchdog::setBudget(const utils::Timeval& budget) {
+        this->budget = budget;
+    }
+
+    const utils::Timeval& Watchdog::getBudget() const {
+        return budget;
+    }
+
+    bool Watchdog::isEnabled() const {
+        return budget > 0;
+    }
+
+    void Watchdog::check(const std::string& name, const utils::Timeval& start) {
+        utils::Timeval duration = utils::Timeval::currentTime() - start;
+
+        if (duration > budget) {
+            LOG(WARNING) << "Watchdog: " << name << " blocked the event loop for " << duration.msd() << " ms";
+
+            if (recordCount < CAPACITY) {
+                records[recordCount++] = {name, duration, EventLoop::getTickCounter()};
+            } else {
+                // Full: the new dispatch evicts the shortest recorded one if it took longer
+                auto shortest = std::min_element(records.begin(), records.end(), [](const Record& record1, const Record& record2) -> bool {
+                    return record1.duration < record2.duration;
+                });
+
+                if (duration > shortest->duration) {
+                    *shortest = {name, duration, EventLoop::getTickCounter()};
+                }
+            }
+        }
+    }
+
+    std::vector<Watchdog::Record> Watchdog::getWorstOffenders() const {
+        std::vector<Record> worstOffenders(records.begin(), records.begin() + static_cast<std::ptrdiff_t>(recordCount));
+
+        std::sort(worstOffenders.begin(), worstOffenders.end(), [](const Record& record1, const Record& record2) -> bool {
+            return record1.duration > record2.duration;
+        });
+
+        return worstOffenders;
+    }
+
+    void Watchdog::reset() {
+        records.fill(Record());
+        recordCount = 0;
+    }
+
+} // namespace core
@@ -0,0 +1,66 @@
+/*
+ * snode.c - a slim toolkit for network communication
+ * Copyright (C) 2020, 2021, 2022 Volker Christian <me@vchrist.at>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CORE_WATCHDOG_H
+#define CORE_WATCHDOG_H
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include "utils/Timeval.h"
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core {
+
+    // Times the dispatch of events and keeps the CAPACITY longest dispatches exceeding the budget
+    class Watchdog {
+    public:
+        struct Record {
+            std::string name;
+            utils::Timeval duration;
+            unsigned long tick = 0;
+        };
+
+        static constexpr std::size_t CAPACITY = 64;
+
+        void setBudget(const utils::Timeval& budget);
+        const utils::Timeval& getBudget() const;
+
+        bool isEnabled() const;
+
+        void check(const std::string& name, const utils::Timeval& start);
+
+        // The recorded slow dispatches, worst first
+        std::vector<Record> getWorstOffenders() const;
+        void reset();
+
+    private:
+        utils::Timeval budget;
+
+        std::array<Record, CAPACITY> records;
+        std::size_t recordCount = 0;
+    };
+
+} // namespace core
+
+#endif // CORE_WATCHDOG_H
@@ -55,10 +55,14 @@ namespace core::file {
         return fileReader;
     }
 
+    FileReader* FileReader::connect(int fd, core::pipe::Sink& writeStream, const std::string& name) {
+        return new FileReader(fd, writeStream, name);
+    }
+
     void FileReader::event([[maybe_unused]] const utils::Timeval& currentTime) {
         if (!suspended) {
             // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays, modernize-avoid-c-arrays)
-            static char junk[MFREADSIZE];
+            static thread_local char junk[MFREADSIZE]; // one per event loop thread
 
             ssize_t ret = core::system::read(getFd(), junk, MFREADSIZE);
 
@@ -84,8 +88,10 @@ namespace core::file {
     }
 
     void FileReader::resume() {
-        suspended = false;
-        publish();
+        if (suspended) {
+            suspended = false;
+            publish();
+        }
     }
 
     bool FileReader::isSuspended() {
@@ -50,10 +50,13 @@ namespace core::file {
     public:
         static FileReader* connect(const std::string& path, core::pipe::Sink& writeStream, const std::function<void(int err)>& onError);
 
+        // Takes over the already opened fd
+        static FileReader* connect(int fd, core::pipe::Sink& writeStream, const std::string& name);
+
         void event(const utils::Timeval& currentTime) override;
 
-        void suspend();
-        void resume();
+        void suspend() override;
+        void resume() override;
 
         bool isSuspended();
 
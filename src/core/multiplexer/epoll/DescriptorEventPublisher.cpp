@@ -18,114 +18,50 @@
 
 #include "core/multiplexer/epoll/DescriptorEventPublisher.h"
 
-#include "core/DescriptorEventReceiver.h"
+#include "core/multiplexer/epoll/EventMultiplexer.h"
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
-#include <cerrno>
-
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
 namespace core::epoll {
 
-    DescriptorEventPublisher::EPollEvents::EPollEvents(int& epfd, uint32_t events)
-        : epfd(epfd)
-        , events(events) {
-        epfd = core::system::epoll_create1(EPOLL_CLOEXEC);
-        interestCount = 0;
-        ePollEvents.resize(1);
-    }
-
-    void DescriptorEventPublisher::EPollEvents::muxAdd(core::DescriptorEventReceiver* eventReceiver) {
-        epoll_event ePollEvent;
-
-        ePollEvent.data.ptr = eventReceiver;
-        ePollEvent.events = events;
-
-        if (core::system::epoll_ctl(epfd, EPOLL_CTL_ADD, eventReceiver->getRegisteredFd(), &ePollEvent) == 0) {
-            interestCount++;
-
-            if (interestCount >= ePollEvents.size()) {
-                ePollEvents.resize(ePollEvents.size() * 2);
-            }
-        } else if (errno == EEXIST) {
-            muxMod(eventReceiver->getRegisteredFd(), events, eventReceiver);
-        }
-    }
-
-    void DescriptorEventPublisher::EPollEvents::muxDel(int fd) {
-        if (core::system::epoll_ctl(epfd, EPOLL_CTL_DEL, fd, nullptr) == 0 || errno == EBADF) {
-            interestCount--;
-
-            if (ePollEvents.size() > (interestCount * 2) + 1) {
-                ePollEvents.resize(ePollEvents.size() / 2);
-                ePollEvents.shrink_to_fit();
-            }
-        }
-    }
-
-    void DescriptorEventPublisher::EPollEvents::muxMod(int fd, uint32_t events, core::DescriptorEventReceiver* eventReceiver) {
-        epoll_event ePollEvent;
-
-        ePollEvent.data.ptr = eventReceiver;
-        ePollEvent.events = events;
-
-        core::system::epoll_ctl(epfd, EPOLL_CTL_MOD, fd, &ePollEvent);
-    }
-
-    void DescriptorEventPublisher::EPollEvents::muxOn(core::DescriptorEventReceiver* eventReceiver) {
-        muxMod(eventReceiver->getRegisteredFd(), events, eventReceiver);
-    }
-
-    void DescriptorEventPublisher::EPollEvents::muxOff(DescriptorEventReceiver* eventReceiver) {
-        muxMod(eventReceiver->getRegisteredFd(), 0, eventReceiver);
-    }
-
-    int DescriptorEventPublisher::EPollEvents::getEPFd() const {
-        return epfd;
-    }
-
-    epoll_event* DescriptorEventPublisher::EPollEvents::getEvents() {
-        return ePollEvents.data();
-    }
-
-    int DescriptorEventPublisher::EPollEvents::getInterestCount() const {
-        return static_cast<int>(interestCount);
-    }
-
-    DescriptorEventPublisher::DescriptorEventPublisher(const std::string& name, int& epfd, uint32_t events)
+    DescriptorEventPublisher::DescriptorEventPublisher(const std::string& name,
+                                                       core::epoll::EPollEvents& ePollEvents,
+                                                       core::DescriptorEventReceiver::DISP_TYPE dispType,
+                                                       uint32_t events)
         : core::DescriptorEventPublisher(name)
-        , ePollEvents(epfd, events) {
+        , ePollEvents(ePollEvents)
+        , dispType(dispType)
+        , events(events) {
     }
 
     void DescriptorEventPublisher::muxAdd(core::DescriptorEventReceiver* eventReceiver) {
-        ePollEvents.muxAdd(eventReceiver);
+        ePollEvents.muxAdd(eventReceiver, dispType, events);
     }
 
     void DescriptorEventPublisher::muxDel(int fd) {
-        ePollEvents.muxDel(fd);
+        ePollEvents.muxDel(fd, dispType, events);
     }
 
     void DescriptorEventPublisher::muxOn(core::DescriptorEventReceiver* eventReceiver) {
-        ePollEvents.muxOn(eventReceiver);
+        if (ePollEvents.muxOn(eventReceiver, dispType, events)) {
+            publishActiveEvent(eventReceiver);
+        }
     }
 
     void DescriptorEventPublisher::muxOff(DescriptorEventReceiver* eventReceiver) {
-        ePollEvents.muxOff(eventReceiver);
+        ePollEvents.muxOff(eventReceiver, dispType, events);
     }
 
-    int DescriptorEventPublisher::publishActiveEvents() {
-        int count = core::system::epoll_wait(ePollEvents.getEPFd(), ePollEvents.getEvents(), ePollEvents.getInterestCount(), 0);
-
-        for (int i = 0; i < count; i++) {
-            core::DescriptorEventReceiver* eventReceiver = static_cast<core::DescriptorEventReceiver*>(ePollEvents.getEvents()[i].data.ptr);
-            if (eventReceiver != nullptr) {
-                eventCounter++;
-                eventReceiver->publish();
-            }
-        }
+    void DescriptorEventPublisher::publishActiveEvent(core::DescriptorEventReceiver* eventReceiver) {
+        eventCounter++;
+        eventReceiver->publish();
+    }
 
-        return count;
+    int DescriptorEventPublisher::publishActiveEvents() {
+        // Active events of all three publishers are dispatched by core::epoll::EventMultiplexer in one pass
+        return 0;
     }
 
 } // namespace core::epoll
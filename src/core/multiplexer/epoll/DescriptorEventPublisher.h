@@ -23,15 +23,18 @@
 
 namespace core {
     class DescriptorEventReceiver;
+
+    namespace epoll {
+        class EPollEvents;
+    } // namespace epoll
 } // namespace core
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
-#include "core/system/epoll.h"
+#include "core/DescriptorEventReceiver.h"
 
 #include <cstdint>
 #include <string>
-#include <vector>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
@@ -41,35 +44,13 @@ namespace core::epoll {
         DescriptorEventPublisher(const DescriptorEventPublisher&) = delete;
         DescriptorEventPublisher& operator=(const DescriptorEventPublisher&) = delete;
 
-    private:
-        class EPollEvents {
-        public:
-            explicit EPollEvents(int& epfd, uint32_t event);
-
-        private:
-            void muxMod(int fd, uint32_t events, core::DescriptorEventReceiver* eventReceiver);
-
-        public:
-            void muxAdd(core::DescriptorEventReceiver* eventReceiver);
-            void muxDel(int fd);
-
-            void muxOn(core::DescriptorEventReceiver* eventReceiver);
-            void muxOff(core::DescriptorEventReceiver* eventReceiver);
-
-            int getEPFd() const;
-            epoll_event* getEvents();
-            int getInterestCount() const;
-
-        private:
-            int& epfd;
-            uint32_t events;
-
-            std::vector<epoll_event> ePollEvents;
-            std::vector<epoll_event>::size_type interestCount;
-        };
-
     public:
-        explicit DescriptorEventPublisher(const std::string& name, int& epfd, uint32_t events);
+        DescriptorEventPublisher(const std::string& name,
+                                 core::epoll::EPollEvents& ePollEvents,
+                                 core::DescriptorEventReceiver::DISP_TYPE dispType,
+                                 uint32_t events);
+
+        void publishActiveEvent(core::DescriptorEventReceiver* eventReceiver);
 
     private:
         void muxAdd(core::DescriptorEventReceiver* eventReceiver) override;
@@ -79,8 +60,9 @@ namespace core::epoll {
 
         int publishActiveEvents() override;
 
-    private:
-        EPollEvents ePollEvents;
+        core::epoll::EPollEvents& ePollEvents;
+        core::DescriptorEventReceiver::DISP_TYPE dispType;
+        uint32_t events;
     };
 
 } // namespace core::epoll
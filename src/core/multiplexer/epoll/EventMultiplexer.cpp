@@ -19,47 +19,240 @@
 #include "core/multiplexer/epoll/EventMultiplexer.h"
 
 #include "core/multiplexer/epoll/DescriptorEventPublisher.h"
+#include "core/system/unistd.h"
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
+#include <cerrno>
+
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
 core::EventMultiplexer& EventMultiplexer() {
-    static core::epoll::EventMultiplexer eventMultiplexer;
+    static thread_local core::epoll::EventMultiplexer eventMultiplexer;
 
     return eventMultiplexer;
 }
 
 namespace core::epoll {
 
-    EventMultiplexer::EventMultiplexer()
-        : core::EventMultiplexer(
-              new core::epoll::DescriptorEventPublisher("READ", epfds[core::DescriptorEventReceiver::DISP_TYPE::RD], EPOLLIN),
-              new core::epoll::DescriptorEventPublisher("WRITE", epfds[core::DescriptorEventReceiver::DISP_TYPE::WR], EPOLLOUT),
-              new core::epoll::DescriptorEventPublisher("EXCEPT", epfds[core::DescriptorEventReceiver::DISP_TYPE::EX], EPOLLPRI)) {
-        epfd = core::system::epoll_create1(EPOLL_CLOEXEC);
+#ifdef EPOLL_EDGE_TRIGGERED
+    static const bool edgeTriggeredMode = true;
+#else
+    static const bool edgeTriggeredMode = false;
+#endif
+
+    static const std::array<uint32_t, DISP_COUNT> dispEvents = {EPOLLIN, EPOLLOUT, EPOLLPRI};
+
+    EPollEvents::EPollEvents(bool edgeTriggered)
+        : epfd(core::system::epoll_create1(EPOLL_CLOEXEC))
+        , edgeTriggered(edgeTriggered) {
+        ePollEvents.resize(1);
+    }
+
+    EPollEvents::~EPollEvents() {
+        if (epfd >= 0) {
+            core::system::close(epfd);
+        }
+    }
+
+    EPollEvents::Interest& EPollEvents::getInterest(int fd) {
+        std::vector<Interest>::size_type index = static_cast<std::vector<Interest>::size_type>(fd);
+
+        if (index >= interests.size()) {
+            interests.resize(index + 1);
+        }
+
+        return interests[index];
+    }
+
+    uint32_t EPollEvents::getRegistrationEvents(const Interest& interest) const {
+        uint32_t events = interest.events;
+
+        if (edgeTriggered) {
+            bool edgeTriggerable = true;
+            uint32_t observedEvents = EPOLLET;
+
+            for (std::size_t dispType = 0; dispType < DISP_COUNT; dispType++) {
+                if (interest.eventReceivers[dispType] != nullptr) {
+                    edgeTriggerable = edgeTriggerable && interest.eventReceivers[dispType]->isEdgeTriggerable();
+                    observedEvents |= dispEvents[dispType];
+                }
+            }
+
+            if (edgeTriggerable) {
+                events = observedEvents;
+            }
+        }
+
+        return events;
+    }
+
+    void EPollEvents::muxMod(int fd, Interest& interest) {
+        uint32_t events = getRegistrationEvents(interest);
+
+        if (events != interest.registered) {
+            epoll_event ePollEvent;
+
+            ePollEvent.data.fd = fd;
+            ePollEvent.events = events;
+
+            ctlCount++;
+            core::system::epoll_ctl(epfd, EPOLL_CTL_MOD, fd, &ePollEvent);
+
+            interest.registered = events;
+        }
+    }
+
+    void EPollEvents::muxAdd(core::DescriptorEventReceiver* eventReceiver,
+                             core::DescriptorEventReceiver::DISP_TYPE dispType,
+                             uint32_t events) {
+        int fd = eventReceiver->getRegisteredFd();
+        Interest& interest = getInterest(fd);
+
+        bool registered = interest.eventReceivers[0] != nullptr || interest.eventReceivers[1] != nullptr ||
+                          interest.eventReceivers[2] != nullptr;
+
+        interest.eventReceivers[dispType] = eventReceiver;
+        interest.events |= events;
+        interest.missed &= ~events;
+
+        if (!registered) {
+            epoll_event ePollEvent;
+
+            ePollEvent.data.fd = fd;
+            ePollEvent.events = getRegistrationEvents(interest);
+
+            ctlCount++;
+            if (core::system::epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ePollEvent) == 0) {
+                interest.registered = ePollEvent.events;
+                interestCount++;
+
+                if (interestCount >= ePollEvents.size()) {
+                    ePollEvents.resize(ePollEvents.size() * 2);
+                }
+            } else if (errno == EEXIST) {
+                interest.registered = ~ePollEvent.events; // Force the modification
+                muxMod(fd, interest);
+            }
+        } else {
+            muxMod(fd, interest);
+        }
+    }
 
-        epoll_event event;
-        event.events = EPOLLIN;
+    void EPollEvents::muxDel(int fd, core::DescriptorEventReceiver::DISP_TYPE dispType, uint32_t events) {
+        Interest& interest = getInterest(fd);
 
-        event.data.ptr = descriptorEventPublishers[core::DescriptorEventReceiver::DISP_TYPE::RD];
-        core::system::epoll_ctl(epfd, EPOLL_CTL_ADD, epfds[core::DescriptorEventReceiver::DISP_TYPE::RD], &event);
+        interest.eventReceivers[dispType] = nullptr;
+        interest.events &= ~events;
+        interest.missed &= ~events;
 
-        event.data.ptr = descriptorEventPublishers[core::DescriptorEventReceiver::DISP_TYPE::WR];
-        core::system::epoll_ctl(epfd, EPOLL_CTL_ADD, epfds[core::DescriptorEventReceiver::DISP_TYPE::WR], &event);
+        if (interest.eventReceivers[0] == nullptr && interest.eventReceivers[1] == nullptr && interest.eventReceivers[2] == nullptr) {
+            interest.registered = 0;
 
-        event.data.ptr = descriptorEventPublishers[core::DescriptorEventReceiver::DISP_TYPE::EX];
-        core::system::epoll_ctl(epfd, EPOLL_CTL_ADD, epfds[core::DescriptorEventReceiver::DISP_TYPE::EX], &event);
+            ctlCount++;
+            if (core::system::epoll_ctl(epfd, EPOLL_CTL_DEL, fd, nullptr) == 0 || errno == EBADF) {
+                interestCount--;
+
+                if (ePollEvents.size() > (interestCount * 2) + 1) {
+                    ePollEvents.resize(ePollEvents.size() / 2);
+                    ePollEvents.shrink_to_fit();
+                }
+            }
+        } else {
+            muxMod(fd, interest);
+        }
+    }
+
+    bool EPollEvents::muxOn(core::DescriptorEventReceiver* eventReceiver,
+                            core::DescriptorEventReceiver::DISP_TYPE dispType,
+                            uint32_t events) {
+        int fd = eventReceiver->getRegisteredFd();
+        Interest& interest = getInterest(fd);
+
+        interest.eventReceivers[dispType] = eventReceiver;
+        interest.events |= events;
+
+        muxMod(fd, interest);
+
+        bool missed = (interest.missed & events) != 0;
+        interest.missed &= ~events;
+
+        return missed;
+    }
+
+    void EPollEvents::muxOff(core::DescriptorEventReceiver* eventReceiver,
+                             core::DescriptorEventReceiver::DISP_TYPE dispType,
+                             uint32_t events) {
+        int fd = eventReceiver->getRegisteredFd();
+        Interest& interest = getInterest(fd);
+
+        interest.eventReceivers[dispType] = eventReceiver;
+        interest.events &= ~events;
+
+        muxMod(fd, interest);
+    }
+
+    int EPollEvents::wait(int timeout) {
+        return core::system::epoll_wait(epfd, ePollEvents.data(), static_cast<int>(ePollEvents.size()), timeout);
+    }
+
+    const epoll_event& EPollEvents::getEvent(int index) const {
+        return ePollEvents[static_cast<std::vector<epoll_event>::size_type>(index)];
+    }
+
+    core::DescriptorEventReceiver* EPollEvents::getActiveEventReceiver(const epoll_event& ePollEvent,
+                                                                       core::DescriptorEventReceiver::DISP_TYPE dispType,
+                                                                       uint32_t events) {
+        Interest& interest = interests[static_cast<std::vector<Interest>::size_type>(ePollEvent.data.fd)];
+        core::DescriptorEventReceiver* eventReceiver = interest.eventReceivers[dispType];
+
+        // Error and hangup conditions are reported to every receiver observing the fd
+        if (eventReceiver != nullptr && (ePollEvent.events & (events | EPOLLERR | EPOLLHUP)) != 0) {
+            if ((interest.registered & EPOLLET) != 0 && (interest.events & events) == 0) {
+                // An edge for a suspended receiver would be lost - deliver it when the receiver is resumed
+                interest.missed |= events;
+                eventReceiver = nullptr;
+            }
+        } else {
+            eventReceiver = nullptr;
+        }
+
+        return eventReceiver;
+    }
+
+    unsigned long EPollEvents::getCtlCount() const {
+        return ctlCount;
+    }
+
+    EventMultiplexer::EventMultiplexer()
+        : core::EventMultiplexer(
+              new core::epoll::DescriptorEventPublisher("READ", ePollEvents, core::DescriptorEventReceiver::DISP_TYPE::RD, EPOLLIN),
+              new core::epoll::DescriptorEventPublisher("WRITE", ePollEvents, core::DescriptorEventReceiver::DISP_TYPE::WR, EPOLLOUT),
+              new core::epoll::DescriptorEventPublisher("EXCEPT", ePollEvents, core::DescriptorEventReceiver::DISP_TYPE::EX, EPOLLPRI))
+        , ePollEvents(edgeTriggeredMode) {
+    }
+
+    unsigned long EventMultiplexer::getEPollCtlCount() const {
+        return ePollEvents.getCtlCount();
     }
 
     int EventMultiplexer::multiplex(utils::Timeval& tickTimeout) {
-        return core::system::epoll_wait(epfd, ePollEvents, 3, tickTimeout.ms());
+        return ePollEvents.wait(tickTimeout.ms());
     }
 
     void EventMultiplexer::publishActiveEvents() {
+        int start = activeEventCount > 0 ? static_cast<int>(publishRotation++ % static_cast<unsigned int>(activeEventCount)) : 0;
+
         for (int i = 0; i < activeEventCount; i++) {
-            if ((ePollEvents[i].events & EPOLLIN) != 0) {
-                static_cast<core::DescriptorEventPublisher*>(ePollEvents[i].data.ptr)->publishActiveEvents();
+            const epoll_event& ePollEvent = ePollEvents.getEvent((start + i) % activeEventCount);
+
+            for (std::size_t dispType = 0; dispType < DISP_COUNT; dispType++) {
+                core::DescriptorEventReceiver* eventReceiver = ePollEvents.getActiveEventReceiver(
+                    ePollEvent, static_cast<core::DescriptorEventReceiver::DISP_TYPE>(dispType), dispEvents[dispType]);
+
+                if (eventReceiver != nullptr) {
+                    static_cast<core::epoll::DescriptorEventPublisher*>(descriptorEventPublishers[dispType])->publishActiveEvent(eventReceiver);
+                }
             }
         }
     }
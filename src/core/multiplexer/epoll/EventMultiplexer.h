@@ -1,4 +1,4 @@
-﻿/*
+/*
  * snode.c - a slim toolkit for network communication
  * Copyright (C) 2020, 2021, 2022 Volker Christian <me@vchrist.at>
  *
@@ -21,14 +21,74 @@
 
 #include "core/EventMultiplexer.h"
 
+namespace core {
+    class DescriptorEventReceiver;
+} // namespace core
+
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
 #include "core/system/epoll.h"
 
+#include <array>
+#include <cstdint>
+#include <vector>
+
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
 namespace core::epoll {
 
+    // One epoll instance per loop. Each observed fd is registered once with the OR of the interests of its
+    // read, write and exceptional receivers.
+    //
+    // In edge-triggered mode (mux-epoll-et) an fd whose active receivers are all edge-triggerable is registered
+    // with EPOLLET and the union of their events. Suspend and resume then only flip bits in the interest table.
+    // Edges arriving while a receiver is suspended are remembered and delivered on resume.
+    class EPollEvents {
+        EPollEvents(const EPollEvents&) = delete;
+        EPollEvents& operator=(const EPollEvents&) = delete;
+
+    private:
+        class Interest {
+        public:
+            uint32_t events = 0;
+            uint32_t registered = 0;
+            uint32_t missed = 0;
+            std::array<core::DescriptorEventReceiver*, DISP_COUNT> eventReceivers = {};
+        };
+
+    public:
+        explicit EPollEvents(bool edgeTriggered);
+        ~EPollEvents();
+
+        void muxAdd(core::DescriptorEventReceiver* eventReceiver, core::DescriptorEventReceiver::DISP_TYPE dispType, uint32_t events);
+        void muxDel(int fd, core::DescriptorEventReceiver::DISP_TYPE dispType, uint32_t events);
+        bool muxOn(core::DescriptorEventReceiver* eventReceiver, core::DescriptorEventReceiver::DISP_TYPE dispType, uint32_t events);
+        void muxOff(core::DescriptorEventReceiver* eventReceiver, core::DescriptorEventReceiver::DISP_TYPE dispType, uint32_t events);
+
+        int wait(int timeout);
+
+        const epoll_event& getEvent(int index) const;
+        core::DescriptorEventReceiver*
+        getActiveEventReceiver(const epoll_event& ePollEvent, core::DescriptorEventReceiver::DISP_TYPE dispType, uint32_t events);
+
+        unsigned long getCtlCount() const;
+
+    private:
+        Interest& getInterest(int fd);
+        uint32_t getRegistrationEvents(const Interest& interest) const;
+        void muxMod(int fd, Interest& interest);
+
+        int epfd;
+        bool edgeTriggered;
+
+        std::vector<Interest> interests;
+
+        std::vector<epoll_event> ePollEvents;
+        std::vector<epoll_event>::size_type interestCount = 0;
+
+        unsigned long ctlCount = 0;
+    };
+
     class EventMultiplexer : public core::EventMultiplexer {
         EventMultiplexer(const EventMultiplexer&) = delete;
         EventMultiplexer& operator=(const EventMultiplexer&) = delete;
@@ -37,14 +97,16 @@ namespace core::epoll {
         EventMultiplexer();
         ~EventMultiplexer() override = default;
 
+        unsigned long getEPollCtlCount() const;
+
     private:
         int multiplex(utils::Timeval& tickTimeout) override;
         void publishActiveEvents() override;
 
-        int epfd;
+        EPollEvents ePollEvents;
 
-        int epfds[3];
-        epoll_event ePollEvents[3];
+        // Round robin start of publishing the ready events, thus the first reported fd is not always served first
+        unsigned int publishRotation = 0;
     };
 
 } // namespace core::epoll
@@ -0,0 +1,177 @@
+/*
+ * snode.c - a slim toolkit for network communication
+ * Copyright (C) 2020, 2021, 2022 Volker Christian <me@vchrist.at>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/multiplexer/iouring/DescriptorEventPublisher.h"
+
+#include "core/DescriptorEventReceiver.h"
+#include "core/multiplexer/iouring/EventMultiplexer.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <cerrno>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core::iouring {
+
+    DescriptorEventPublisher::DescriptorEventPublisher(const std::string& name,
+                                                       core::iouring::IoUring& ioUring,
+                                                       unsigned int dispType,
+                                                       uint32_t events)
+        : core::DescriptorEventPublisher(name)
+        , ioUring(ioUring)
+        , dispType(dispType)
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        , events((events << 16) | (events >> 16)) { // The kernel expects poll32_events in little endian halfword order
+#else
+        , events(events) {
+#endif
+    }
+
+    DescriptorEventPublisher::PollState& DescriptorEventPublisher::getPollState(int fd) {
+        std::vector<PollState>::size_type index = static_cast<std::vector<PollState>::size_type>(fd);
+
+        if (index >= pollStates.size()) {
+            pollStates.resize(index + 1);
+        }
+
+        return pollStates[index];
+    }
+
+    void DescriptorEventPublisher::arm(int fd) {
+        PollState& pollState = getPollState(fd);
+
+        pollState.wanted = true;
+
+        if (!pollState.armed && !pollState.pending) {
+            pollState.pending = true;
+            pendingFds.push_back(fd);
+        }
+    }
+
+    void DescriptorEventPublisher::muxAdd(core::DescriptorEventReceiver* eventReceiver) {
+        arm(eventReceiver->getRegisteredFd());
+    }
+
+    void DescriptorEventPublisher::muxDel(int fd) {
+        PollState& pollState = getPollState(fd);
+
+        if (pollState.armed) {
+            // The in-flight poll request holds a reference to the file - it must be removed explicitly
+            pendingCancels.push_back(EventMultiplexer::encodeUserData(fd, pollState.generation, dispType));
+            pollState.armed = false;
+        }
+
+        pollState.wanted = false;
+        pollState.generation++; // Completions of the old registration are ignored from now on
+    }
+
+    void DescriptorEventPublisher::muxOn(core::DescriptorEventReceiver* eventReceiver) {
+        arm(eventReceiver->getRegisteredFd());
+    }
+
+    void DescriptorEventPublisher::muxOff(core::DescriptorEventReceiver* eventReceiver) {
+        // A still armed single-shot poll request is left in flight. Its completion is dropped if the receiver is
+        // still suspended then. Thus suspend() costs no submission at all.
+        getPollState(eventReceiver->getRegisteredFd()).wanted = false;
+    }
+
+    void DescriptorEventPublisher::prepareSubmissions() {
+        std::vector<uint64_t>::size_type cancelCount = 0;
+
+        for (; cancelCount < pendingCancels.size(); cancelCount++) {
+            io_uring_sqe* sqe = ioUring.getSqe();
+
+            if (sqe == nullptr) {
+                break;
+            }
+
+            sqe->opcode = IORING_OP_POLL_REMOVE;
+            sqe->fd = -1;
+            sqe->addr = pendingCancels[cancelCount];
+            sqe->user_data = EventMultiplexer::INTERNAL;
+        }
+        pendingCancels.erase(pendingCancels.begin(), pendingCancels.begin() + static_cast<long>(cancelCount));
+
+        std::vector<int>::size_type armCount = 0;
+
+        for (; armCount < pendingFds.size(); armCount++) {
+            int fd = pendingFds[armCount];
+            PollState& pollState = pollStates[static_cast<std::vector<PollState>::size_type>(fd)];
+
+            if (pollState.wanted && !pollState.armed) {
+                io_uring_sqe* sqe = ioUring.getSqe();
+
+                if (sqe == nullptr) {
+                    break;
+                }
+
+                sqe->opcode = IORING_OP_POLL_ADD;
+                sqe->fd = fd;
+                sqe->poll32_events = events;
+                sqe->user_data = EventMultiplexer::encodeUserData(fd, pollState.generation, dispType);
+
+                pollState.armed = true;
+            }
+
+            pollState.pending = false;
+        }
+        pendingFds.erase(pendingFds.begin(), pendingFds.begin() + static_cast<long>(armCount));
+    }
+
+    void DescriptorEventPublisher::completion(int fd, uint32_t generation, int result) {
+        std::vector<PollState>::size_type index = static_cast<std::vector<PollState>::size_type>(fd);
+
+        if (index < pollStates.size()) {
+            PollState& pollState = pollStates[index];
+
+            if (pollState.armed && pollState.generation == generation) {
+                pollState.armed = false;
+
+                if (pollState.wanted) {
+                    // A failed poll is published as well: the receiver learns about the error from its next I/O call, like with epoll
+                    if (result != -ECANCELED) {
+                        activeFds.push_back(fd);
+                    }
+                    arm(fd); // Single-shot poll gives level-triggered semantics: rearm with the next submission
+                }
+            }
+        }
+    }
+
+    int DescriptorEventPublisher::publishActiveEvents() {
+        int count = 0;
+
+        std::size_t start = getPublishStart(activeFds.size());
+
+        for (std::size_t i = 0; i < activeFds.size(); i++) {
+            int fd = activeFds[(start + i) % activeFds.size()];
+            core::DescriptorEventReceiver* eventReceiver = getObservedEventReceiver(fd);
+
+            if (eventReceiver != nullptr) {
+                eventCounter++;
+                eventReceiver->publish();
+                count++;
+            }
+        }
+        activeFds.clear();
+
+        return count;
+    }
+
+} // namespace core::iouring
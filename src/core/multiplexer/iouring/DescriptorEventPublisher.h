@@ -0,0 +1,84 @@
+/*
+ * snode.c - a slim toolkit for network communication
+ * Copyright (C) 2020, 2021, 2022 Volker Christian <me@vchrist.at>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CORE_IOURING_DESCRIPTOREVENTPUBLISHER_H
+#define CORE_IOURING_DESCRIPTOREVENTPUBLISHER_H
+
+#include "core/DescriptorEventPublisher.h" // IWYU pragma: export
+
+namespace core {
+    class DescriptorEventReceiver;
+
+    namespace iouring {
+        class IoUring;
+    } // namespace iouring
+} // namespace core
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core::iouring {
+
+    class DescriptorEventPublisher : public core::DescriptorEventPublisher {
+        DescriptorEventPublisher(const DescriptorEventPublisher&) = delete;
+        DescriptorEventPublisher& operator=(const DescriptorEventPublisher&) = delete;
+
+    private:
+        class PollState {
+        public:
+            uint32_t generation = 0;
+            bool wanted = false;
+            bool armed = false;
+            bool pending = false;
+        };
+
+    public:
+        DescriptorEventPublisher(const std::string& name, core::iouring::IoUring& ioUring, unsigned int dispType, uint32_t events);
+
+        void prepareSubmissions();
+        void completion(int fd, uint32_t generation, int result);
+
+    private:
+        void muxAdd(core::DescriptorEventReceiver* eventReceiver) override;
+        void muxDel(int fd) override;
+        void muxOn(core::DescriptorEventReceiver* eventReceiver) override;
+        void muxOff(core::DescriptorEventReceiver* eventReceiver) override;
+
+        int publishActiveEvents() override;
+
+        PollState& getPollState(int fd);
+        void arm(int fd);
+
+        core::iouring::IoUring& ioUring;
+        unsigned int dispType;
+        uint32_t events;
+
+        std::vector<PollState> pollStates;
+        std::vector<int> pendingFds;
+        std::vector<uint64_t> pendingCancels;
+        std::vector<int> activeFds;
+    };
+
+} // namespace core::iouring
+
+#endif // CORE_IOURING_DESCRIPTOREVENTPUBLISHER_H
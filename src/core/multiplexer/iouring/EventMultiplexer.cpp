@@ -0,0 +1,246 @@
+/*
+ * snode.c - a slim toolkit for network communication
+ * Copyright (C) 2020, 2021, 2022 Volker Christian <me@vchrist.at>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/multiplexer/iouring/EventMultiplexer.h"
+
+#include "core/multiplexer/iouring/DescriptorEventPublisher.h"
+#include "core/system/mman.h"
+#include "core/system/unistd.h"
+#include "utils/Timeval.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <poll.h>
+#include <sys/time.h>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+#ifndef IOURING_ENTRIES
+#define IOURING_ENTRIES 4096
+#endif
+
+core::EventMultiplexer& EventMultiplexer() {
+    static thread_local core::iouring::EventMultiplexer eventMultiplexer;
+
+    return eventMultiplexer;
+}
+
+namespace core::iouring {
+
+    IoUring::IoUring(unsigned int entries) {
+        io_uring_params params;
+        std::memset(&params, 0, sizeof(params));
+
+        ringFd = core::system::io_uring_setup(entries, &params);
+
+        if (ringFd >= 0) {
+            if ((params.features & IORING_FEAT_EXT_ARG) != 0) { // Needed to wait with a timeout (Linux >= 5.11)
+                sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+                cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+                if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0) {
+                    sqRingSize = cqRingSize = std::max(sqRingSize, cqRingSize);
+                }
+
+                sqRing = core::system::mmap(nullptr, sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQ_RING);
+
+                if (sqRing != MAP_FAILED && (params.features & IORING_FEAT_SINGLE_MMAP) != 0) {
+                    cqRing = sqRing;
+                } else if (sqRing != MAP_FAILED) {
+                    cqRing = core::system::mmap(
+                        nullptr, cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_CQ_RING);
+                }
+
+                sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+                void* sqesMap = MAP_FAILED;
+                if (sqRing != MAP_FAILED && cqRing != MAP_FAILED) {
+                    sqesMap =
+                        core::system::mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQES);
+                }
+
+                if (sqesMap != MAP_FAILED) {
+                    char* sqBase = static_cast<char*>(sqRing);
+                    char* cqBase = static_cast<char*>(cqRing);
+
+                    sqes = static_cast<io_uring_sqe*>(sqesMap);
+                    sqHead = reinterpret_cast<unsigned int*>(sqBase + params.sq_off.head);
+                    sqTail = reinterpret_cast<unsigned int*>(sqBase + params.sq_off.tail);
+                    sqRingMask = *reinterpret_cast<unsigned int*>(sqBase + params.sq_off.ring_mask);
+                    sqRingEntries = *reinterpret_cast<unsigned int*>(sqBase + params.sq_off.ring_entries);
+
+                    cqHead = reinterpret_cast<unsigned int*>(cqBase + params.cq_off.head);
+                    cqTail = reinterpret_cast<unsigned int*>(cqBase + params.cq_off.tail);
+                    cqRingMask = *reinterpret_cast<unsigned int*>(cqBase + params.cq_off.ring_mask);
+                    cqes = reinterpret_cast<io_uring_cqe*>(cqBase + params.cq_off.cqes);
+
+                    // The sqe slots are always used in ring order, thus the indirection array is set up once
+                    unsigned int* sqArray = reinterpret_cast<unsigned int*>(sqBase + params.sq_off.array);
+                    for (unsigned int i = 0; i < sqRingEntries; i++) {
+                        sqArray[i] = i;
+                    }
+
+                    sqeTail = *sqTail;
+                } else {
+                    int errnum = errno;
+
+                    if (cqRing != MAP_FAILED && cqRing != nullptr && cqRing != sqRing) {
+                        core::system::munmap(cqRing, cqRingSize);
+                    }
+                    if (sqRing != MAP_FAILED) {
+                        core::system::munmap(sqRing, sqRingSize);
+                    }
+                    sqRing = cqRing = nullptr;
+
+                    core::system::close(ringFd);
+                    ringFd = -1;
+
+                    errno = errnum;
+                }
+            } else {
+                core::system::close(ringFd);
+                ringFd = -1;
+
+                errno = ENOSYS;
+            }
+        }
+    }
+
+    IoUring::~IoUring() {
+        if (ringFd >= 0) {
+            core::system::munmap(sqes, sqesSize);
+            if (cqRing != sqRing) {
+                core::system::munmap(cqRing, cqRingSize);
+            }
+            core::system::munmap(sqRing, sqRingSize);
+
+            core::system::close(ringFd);
+        }
+    }
+
+    io_uring_sqe* IoUring::getSqe() {
+        io_uring_sqe* sqe = nullptr;
+
+        if (ringFd >= 0) {
+            if (sqeTail - std::atomic_ref<unsigned int>(*sqHead).load(std::memory_order_acquire) >= sqRingEntries) {
+                submit(0, 0, nullptr, 0); // Submission queue is full - hand over what we have so far
+            }
+
+            if (sqeTail - std::atomic_ref<unsigned int>(*sqHead).load(std::memory_order_acquire) < sqRingEntries) {
+                sqe = &sqes[sqeTail & sqRingMask];
+                std::memset(sqe, 0, sizeof(*sqe));
+
+                sqeTail++;
+            }
+        }
+
+        return sqe;
+    }
+
+    int IoUring::submit(unsigned int minComplete, unsigned int flags, const void* arg, std::size_t argsz) {
+        std::atomic_ref<unsigned int>(*sqTail).store(sqeTail, std::memory_order_release);
+
+        unsigned int toSubmit = sqeTail - std::atomic_ref<unsigned int>(*sqHead).load(std::memory_order_acquire);
+
+        return core::system::io_uring_enter(ringFd, toSubmit, minComplete, flags, arg, argsz);
+    }
+
+    int IoUring::submitAndWait(const utils::Timeval& timeout) {
+        int ret = -1;
+
+        if (ringFd >= 0) {
+            const timeval* tv = &timeout;
+
+            __kernel_timespec ts;
+            ts.tv_sec = tv->tv_sec;
+            ts.tv_nsec = tv->tv_usec * 1000;
+
+            io_uring_getevents_arg arg;
+            std::memset(&arg, 0, sizeof(arg));
+            arg.sigmask_sz = _NSIG / 8;
+            arg.ts = reinterpret_cast<uint64_t>(&ts);
+
+            if (submit(1, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeof(arg)) >= 0 || errno == ETIME || errno == EBUSY) {
+                errno = 0;
+                ret = static_cast<int>(getReadyCount());
+            }
+        } else if (errno == 0) {
+            errno = ENOSYS;
+        }
+
+        return ret;
+    }
+
+    unsigned int IoUring::getReadyCount() const {
+        return std::atomic_ref<unsigned int>(*cqTail).load(std::memory_order_acquire) - *cqHead;
+    }
+
+    void IoUring::forEachCqe(const std::function<void(const io_uring_cqe&)>& onCqe) {
+        if (ringFd >= 0) {
+            unsigned int head = *cqHead;
+            unsigned int tail = std::atomic_ref<unsigned int>(*cqTail).load(std::memory_order_acquire);
+
+            for (; head != tail; head++) {
+                onCqe(cqes[head & cqRingMask]);
+            }
+
+            std::atomic_ref<unsigned int>(*cqHead).store(head, std::memory_order_release);
+        }
+    }
+
+    EventMultiplexer::EventMultiplexer()
+        : core::EventMultiplexer(
+              new core::iouring::DescriptorEventPublisher("READ", ioUring, core::DescriptorEventReceiver::DISP_TYPE::RD, POLLIN),
+              new core::iouring::DescriptorEventPublisher("WRITE", ioUring, core::DescriptorEventReceiver::DISP_TYPE::WR, POLLOUT),
+              new core::iouring::DescriptorEventPublisher("EXCEPT", ioUring, core::DescriptorEventReceiver::DISP_TYPE::EX, POLLPRI))
+        , ioUring(IOURING_ENTRIES) {
+    }
+
+    uint64_t EventMultiplexer::encodeUserData(int fd, uint32_t generation, unsigned int dispType) {
+        return (static_cast<uint64_t>(generation) << 32) | (static_cast<uint64_t>(static_cast<uint32_t>(fd) & 0x3FFFFFFF) << 2) |
+               (dispType & 0x3);
+    }
+
+    int EventMultiplexer::multiplex(utils::Timeval& tickTimeOut) {
+        for (core::DescriptorEventPublisher* const descriptorEventPublisher : descriptorEventPublishers) {
+            static_cast<core::iouring::DescriptorEventPublisher*>(descriptorEventPublisher)->prepareSubmissions();
+        }
+
+        return ioUring.submitAndWait(tickTimeOut);
+    }
+
+    void EventMultiplexer::publishActiveEvents() {
+        ioUring.forEachCqe([this](const io_uring_cqe& cqe) -> void {
+            unsigned int dispType = static_cast<unsigned int>(cqe.user_data & 0x3);
+
+            if (dispType != INTERNAL) {
+                static_cast<core::iouring::DescriptorEventPublisher*>(descriptorEventPublishers[dispType])
+                    ->completion(static_cast<int>((cqe.user_data >> 2) & 0x3FFFFFFF), static_cast<uint32_t>(cqe.user_data >> 32), cqe.res);
+            }
+        });
+
+        for (core::DescriptorEventPublisher* const descriptorEventPublisher : descriptorEventPublishers) {
+            descriptorEventPublisher->publishActiveEvents();
+        }
+    }
+
+} // namespace core::iouring
@@ -0,0 +1,96 @@
+/*
+ * snode.c - a slim toolkit for network communication
+ * Copyright (C) 2020, 2021, 2022 Volker Christian <me@vchrist.at>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CORE_IOURING_EVENTMULTIPLEXER_H
+#define CORE_IOURING_EVENTMULTIPLEXER_H
+
+#include "core/EventMultiplexer.h" // IWYU pragma: export
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include "core/system/io_uring.h" // IWYU pragma: export
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core::iouring {
+
+    class IoUring {
+    public:
+        explicit IoUring(unsigned int entries);
+        ~IoUring();
+
+        IoUring(const IoUring&) = delete;
+        IoUring& operator=(const IoUring&) = delete;
+
+        io_uring_sqe* getSqe();
+
+        int submitAndWait(const utils::Timeval& timeout);
+        void forEachCqe(const std::function<void(const io_uring_cqe&)>& onCqe);
+
+    private:
+        int submit(unsigned int minComplete, unsigned int flags, const void* arg, std::size_t argsz);
+        unsigned int getReadyCount() const;
+
+        int ringFd = -1;
+
+        void* sqRing = nullptr;
+        std::size_t sqRingSize = 0;
+        void* cqRing = nullptr;
+        std::size_t cqRingSize = 0;
+        io_uring_sqe* sqes = nullptr;
+        std::size_t sqesSize = 0;
+
+        unsigned int* sqHead = nullptr;
+        unsigned int* sqTail = nullptr;
+        unsigned int sqRingMask = 0;
+        unsigned int sqRingEntries = 0;
+
+        unsigned int* cqHead = nullptr;
+        unsigned int* cqTail = nullptr;
+        unsigned int cqRingMask = 0;
+        io_uring_cqe* cqes = nullptr;
+
+        unsigned int sqeTail = 0;
+    };
+
+    class EventMultiplexer : public core::EventMultiplexer {
+        EventMultiplexer(const EventMultiplexer&) = delete;
+        EventMultiplexer& operator=(const EventMultiplexer&) = delete;
+
+    public:
+        EventMultiplexer();
+        ~EventMultiplexer() override = default;
+
+        // user_data layout of a poll request: | generation (32) | fd (30) | dispType (2) |
+        static uint64_t encodeUserData(int fd, uint32_t generation, unsigned int dispType);
+        static const uint64_t INTERNAL = 3;
+
+    private:
+        int multiplex(utils::Timeval& tickTimeOut) override;
+        void publishActiveEvents() override;
+
+        IoUring ioUring;
+    };
+
+} // namespace core::iouring
+
+#endif // CORE_IOURING_EVENTMULTIPLEXER_H
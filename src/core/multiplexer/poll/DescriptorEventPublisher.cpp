@@ -20,10 +20,11 @@
 
 #include "core/multiplexer/poll/EventMultiplexer.h"
 
+#include "core/DescriptorEventReceiver.h"
+
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
-#include <unordered_map>
-#include <utility>
+#include <poll.h>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
@@ -56,17 +57,20 @@ namespace core::poll {
         int count = 0;
 
         pollfd* pollfds = pollFds.getEvents();
+        nfds_t currentSize = pollFds.getCurrentSize();
+        nfds_t start = getPublishStart(currentSize);
 
-        const std::unordered_map<int, PollFdsManager::PollFdIndex>& pollFdsIndices = pollFds.getPollFdIndices();
+        for (nfds_t i = 0; i < currentSize; i++) {
+            const pollfd& pollFd = pollfds[(start + i) % currentSize];
 
-        for (auto& [fd, eventReceivers] : observedEventReceivers) {
-            pollfd& pollFd = pollfds[pollFdsIndices.find(fd)->second.index];
+            if (pollFd.fd >= 0 && (pollFd.events & events) != 0 && (pollFd.revents & revents) != 0) {
+                core::DescriptorEventReceiver* eventReceiver = getObservedEventReceiver(pollFd.fd);
 
-            if ((pollFd.events & events) != 0 && (pollFd.revents & revents) != 0) {
-                core::DescriptorEventReceiver* eventReceiver = eventReceivers.front();
-                eventCounter++;
-                eventReceiver->publish();
-                count++;
+                if (eventReceiver != nullptr) {
+                    eventCounter++;
+                    eventReceiver->publish();
+                    count++;
+                }
             }
         }
 
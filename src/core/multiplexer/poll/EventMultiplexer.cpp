@@ -30,7 +30,7 @@
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
 core::EventMultiplexer& EventMultiplexer() {
-    static core::poll::EventMultiplexer eventMultiplexer;
+    static thread_local core::poll::EventMultiplexer eventMultiplexer;
 
     return eventMultiplexer;
 }
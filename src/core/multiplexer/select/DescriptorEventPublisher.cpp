@@ -79,9 +79,14 @@ namespace core::select {
     int DescriptorEventPublisher::publishActiveEvents() {
         int count = 0;
 
-        for (const auto& [fd, eventReceivers] : observedEventReceivers) {
-            if (fdSet.isSet(fd)) {
-                core::DescriptorEventReceiver* eventReceiver = eventReceivers.front();
+        int maxFd = getMaxFd();
+        int start = static_cast<int>(getPublishStart(static_cast<std::size_t>(maxFd + 1)));
+
+        for (int i = 0; i <= maxFd; i++) {
+            int fd = (start + i) % (maxFd + 1);
+            core::DescriptorEventReceiver* eventReceiver = getObservedEventReceiver(fd);
+
+            if (eventReceiver != nullptr && fdSet.isSet(fd)) {
                 eventCounter++;
                 eventReceiver->publish();
                 count++;
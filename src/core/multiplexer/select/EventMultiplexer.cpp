@@ -25,7 +25,7 @@
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
 core::EventMultiplexer& EventMultiplexer() {
-    static core::select::EventMultiplexer eventMultiplexer;
+    static thread_local core::select::EventMultiplexer eventMultiplexer;
 
     return eventMultiplexer;
 }
@@ -44,7 +44,7 @@ namespace core::pipe {
 
     void PipeSink::readEvent() {
         // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays, modernize-avoid-c-arrays)
-        static char junk[MAX_READ_JUNKSIZE];
+        static thread_local char junk[MAX_READ_JUNKSIZE]; // one per event loop thread
 
         ssize_t ret = core::system::read(getRegisteredFd(), junk, MAX_READ_JUNKSIZE);
 
@@ -51,4 +51,16 @@ namespace core::pipe {
         }
     }
 
+    void Sink::suspendSource() {
+        if (source != nullptr) {
+            source->suspend();
+        }
+    }
+
+    void Sink::resumeSource() {
+        if (source != nullptr) {
+            source->resume();
+        }
+    }
+
 } // namespace core::pipe
@@ -44,6 +44,9 @@ namespace core::pipe {
         void connect(Source& source);
         void disconnect(Source& source);
 
+        void suspendSource();
+        void resumeSource();
+
     protected:
         Source* source;
     };
@@ -52,6 +52,8 @@ namespace core::pipe {
     void Source::disconnect(Sink& sink) {
         if (&sink == this->sink) {
             this->sink = nullptr;
+
+            resume(); // a suspended source must notice that its sink is gone
         }
     }
 
@@ -43,6 +43,10 @@ namespace core::pipe {
         void eof();
         void error(int errnum);
 
+        // Used by the sink for backpressure
+        virtual void suspend() = 0;
+        virtual void resume() = 0;
+
     protected:
         Sink* sink;
     };
@@ -20,6 +20,9 @@
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
 namespace core::socket {
@@ -75,6 +78,10 @@ namespace core::socket {
         return getFd() >= 0;
     }
 
+    bool Socket::isTcp() const {
+        return (domain == AF_INET || domain == AF_INET6) && type == SOCK_STREAM;
+    }
+
     int Socket::reuseAddress() const {
         int sockopt = 1;
         return setSockopt(SOL_SOCKET, SO_REUSEADDR, &sockopt, sizeof(sockopt));
@@ -85,6 +92,31 @@ namespace core::socket {
         return setSockopt(SOL_SOCKET, SO_REUSEPORT, &sockopt, sizeof(sockopt));
     }
 
+    int Socket::setTcpNoDelay(bool tcpNoDelay) const {
+        int sockopt = tcpNoDelay ? 1 : 0;
+        return setSockopt(IPPROTO_TCP, TCP_NODELAY, &sockopt, sizeof(sockopt));
+    }
+
+    int Socket::setTcpFastOpen(int queueLength) const {
+        return setSockopt(IPPROTO_TCP, TCP_FASTOPEN, &queueLength, sizeof(queueLength));
+    }
+
+    int Socket::setTcpDeferAccept(int timeout) const {
+        return setSockopt(IPPROTO_TCP, TCP_DEFER_ACCEPT, &timeout, sizeof(timeout));
+    }
+
+    int Socket::setSendBufferSize(int sendBufferSize) const {
+        return setSockopt(SOL_SOCKET, SO_SNDBUF, &sendBufferSize, sizeof(sendBufferSize));
+    }
+
+    int Socket::setReceiveBufferSize(int receiveBufferSize) const {
+        return setSockopt(SOL_SOCKET, SO_RCVBUF, &receiveBufferSize, sizeof(receiveBufferSize));
+    }
+
+    int Socket::setBusyPoll(int busyPoll) const {
+        return setSockopt(SOL_SOCKET, SO_BUSY_POLL, &busyPoll, sizeof(busyPoll));
+    }
+
     int Socket::getSockError() const {
         int cErrno = 0;
         socklen_t cErrnoLen = sizeof(cErrno);
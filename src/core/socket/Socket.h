@@ -50,10 +50,18 @@ namespace core::socket {
         int open(Flags flags = Flags::NONE);
 
         bool isValid() const;
+        bool isTcp() const;
 
         int reuseAddress() const;
         int reusePort() const;
 
+        int setTcpNoDelay(bool tcpNoDelay) const;
+        int setTcpFastOpen(int queueLength) const;
+        int setTcpDeferAccept(int timeout) const;
+        int setSendBufferSize(int sendBufferSize) const;
+        int setReceiveBufferSize(int receiveBufferSize) const;
+        int setBusyPoll(int busyPoll) const;
+
         int getSockError() const;
 
         int setSockopt(int level, int optname, const void* optval, socklen_t optlen) const;
@@ -63,6 +63,14 @@ namespace core::socket {
         socketContext->onReadError(errnum);
     }
 
+    void SocketConnection::onWriteBufferFull() {
+        socketContext->onWriteBufferFull();
+    }
+
+    void SocketConnection::onWriteBufferDrained() {
+        socketContext->onWriteBufferDrained();
+    }
+
     core::socket::SocketContext* SocketConnection::getSocketContext() {
         return socketContext;
     }
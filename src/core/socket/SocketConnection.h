@@ -32,7 +32,11 @@ namespace core::socket {
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
 #include <cstddef>
+#include <memory>
+#include <span>
 #include <string>
+#include <sys/types.h>
+#include <vector>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
@@ -67,13 +71,22 @@ namespace core::socket {
         void onWriteError(int errnum);
         void onReadError(int errnum);
 
+        void onWriteBufferFull();
+        void onWriteBufferDrained();
+
         core::socket::SocketContext* setSocketContext(core::socket::SocketContextFactory* socketContextFactory);
 
     public: // will be called class SocketContext
         virtual void sendToPeer(const char* junk, std::size_t junkLen) = 0;
         virtual void sendToPeer(const std::string& data) = 0;
+        virtual void sendToPeer(std::string&& data) = 0;
+        virtual void sendToPeer(std::vector<char>&& data) = 0;
+        virtual void sendToPeer(const std::shared_ptr<const std::string>& data) = 0;
+        virtual bool sendFileToPeer(int fd, off_t offset, std::size_t count) = 0;
 
         virtual std::size_t readFromPeer(char* junk, std::size_t junkLen) = 0;
+        virtual std::span<const char> peekFromPeer() = 0;
+        virtual std::size_t consumeFromPeer(std::size_t junkLen) = 0;
 
         core::socket::SocketContext* switchSocketContext(core::socket::SocketContextFactory* socketContextFactory);
 
@@ -24,6 +24,8 @@
 
 #include "log/Logger.h"
 
+#include <utility>
+
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
 namespace core::socket {
@@ -40,10 +42,34 @@ namespace core::socket {
         sendToPeer(data.data(), data.length());
     }
 
+    void SocketContext::sendToPeer(std::string&& data) {
+        socketConnection->sendToPeer(std::move(data));
+    }
+
+    void SocketContext::sendToPeer(std::vector<char>&& data) {
+        socketConnection->sendToPeer(std::move(data));
+    }
+
+    void SocketContext::sendToPeer(const std::shared_ptr<const std::string>& data) {
+        socketConnection->sendToPeer(data);
+    }
+
+    bool SocketContext::sendFileToPeer(int fd, off_t offset, std::size_t count) {
+        return socketConnection->sendFileToPeer(fd, offset, count);
+    }
+
     std::size_t SocketContext::readFromPeer(char* junk, std::size_t junklen) {
         return socketConnection->readFromPeer(junk, junklen);
     }
 
+    std::span<const char> SocketContext::peekFromPeer() {
+        return socketConnection->peekFromPeer();
+    }
+
+    std::size_t SocketContext::consumeFromPeer(std::size_t junklen) {
+        return socketConnection->consumeFromPeer(junklen);
+    }
+
     SocketContext* SocketContext::switchSocketContext(core::socket::SocketContextFactory* socketContextFactory) {
         return socketConnection->switchSocketContext(socketContextFactory);
     }
@@ -96,4 +122,10 @@ namespace core::socket {
         shutdownWrite();
     }
 
+    void SocketContext::onWriteBufferFull() {
+    }
+
+    void SocketContext::onWriteBufferDrained() {
+    }
+
 } // namespace core::socket
@@ -32,7 +32,11 @@ namespace core::socket {
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
 #include <cstddef> // IWYU pragma: export
+#include <memory>
+#include <span>
 #include <string>
+#include <sys/types.h>
+#include <vector>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
@@ -50,7 +54,13 @@ namespace core::socket {
 
         void sendToPeer(const char* junk, std::size_t junkLen);
         void sendToPeer(const std::string& data);
+        void sendToPeer(std::string&& data);
+        void sendToPeer(std::vector<char>&& data);
+        void sendToPeer(const std::shared_ptr<const std::string>& data);
+        bool sendFileToPeer(int fd, off_t offset, std::size_t count); // false: fd is not taken over
         std::size_t readFromPeer(char* junk, std::size_t junklen);
+        std::span<const char> peekFromPeer();             // unread bytes, valid until onReceiveFromPeer() returns
+        std::size_t consumeFromPeer(std::size_t junklen); // marks peeked bytes as read
 
         void shutdownRead();
         void shutdownWrite(bool forceClose = false);
@@ -69,6 +79,10 @@ namespace core::socket {
         virtual void onWriteError(int errnum);
         virtual void onReadError(int errnum);
 
+        // Backpressure: the queued bytes of the writer exceeded the high watermark or went back below the low watermark
+        virtual void onWriteBufferFull();
+        virtual void onWriteBufferDrained();
+
         core::socket::SocketConnection* socketConnection;
 
         friend class core::socket::SocketConnection;
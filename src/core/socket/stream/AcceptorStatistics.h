@@ -0,0 +1,41 @@
+/*
+ * snode.c - a slim toolkit for network communication
+ * Copyright (C) 2020, 2021, 2022 Volker Christian <me@vchrist.at>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CORE_SOCKET_STREAM_ACCEPTORSTATISTICS_H
+#define CORE_SOCKET_STREAM_ACCEPTORSTATISTICS_H
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <atomic>
+#include <cstddef>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core::socket::stream {
+
+    // Counters of all acceptors of one server instance. They are updated by the event loops (threads) of the instance
+    struct AcceptorStatistics {
+        std::atomic<unsigned long> accepted = 0; // connections accepted, including those dispatched to cluster workers
+        std::atomic<unsigned long> rejected = 0; // connections closed right after accept as no descriptor was left
+        std::atomic<unsigned long> paused = 0;   // times accepting has been paused under overload
+        std::atomic<std::size_t> active = 0;     // connections served by this process currently
+    };
+
+} // namespace core::socket::stream
+
+#endif // CORE_SOCKET_STREAM_ACCEPTORSTATISTICS_H
@@ -0,0 +1,72 @@
+/*
+ * snode.c - a slim toolkit for network communication
+ * Copyright (C) 2020, 2021, 2022 Volker Christian <me@vchrist.at>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/socket/stream/AdaptiveBlockSize.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <algorithm>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core::socket::stream {
+
+    AdaptiveBlockSize::AdaptiveBlockSize(std::size_t blockSize)
+        : blockSize(blockSize)
+        , minBlockSize(blockSize)
+        , maxBlockSize(blockSize) {
+    }
+
+    void AdaptiveBlockSize::setLimits(std::size_t minBlockSize, std::size_t maxBlockSize) {
+        this->minBlockSize = std::max<std::size_t>(minBlockSize, 1);
+        this->maxBlockSize = std::max(this->minBlockSize, maxBlockSize);
+
+        blockSize = std::clamp(blockSize, this->minBlockSize, this->maxBlockSize);
+    }
+
+    void AdaptiveBlockSize::transferred(std::size_t requested, std::size_t done) {
+        if (done >= requested) {
+            blockSize = std::min(blockSize * 2, maxBlockSize);
+            smallTransfers = 0;
+        } else if (done < requested / 4) {
+            if (++smallTransfers >= ADAPTIVEBLOCKSIZE_SHRINK_AFTER) {
+                blockSize = std::max(blockSize / 2, minBlockSize);
+                smallTransfers = 0;
+            }
+        } else {
+            smallTransfers = 0;
+        }
+    }
+
+    std::size_t AdaptiveBlockSize::get() const {
+        return blockSize;
+    }
+
+    std::size_t AdaptiveBlockSize::getMin() const {
+        return minBlockSize;
+    }
+
+    void AdaptiveBlockSize::set(std::size_t blockSize) {
+        this->blockSize = blockSize;
+        minBlockSize = blockSize;
+        maxBlockSize = blockSize;
+
+        smallTransfers = 0;
+    }
+
+} // namespace core::socket::stream
@@ -0,0 +1,60 @@
+/*
+ * snode.c - a slim toolkit for network communication
+ * Copyright (C) 2020, 2021, 2022 Volker Christian <me@vchrist.at>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CORE_SOCKET_STREAM_ADAPTIVEBLOCKSIZE_H
+#define CORE_SOCKET_STREAM_ADAPTIVEBLOCKSIZE_H
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <cstddef>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+#ifndef ADAPTIVEBLOCKSIZE_SHRINK_AFTER
+#define ADAPTIVEBLOCKSIZE_SHRINK_AFTER 4
+#endif
+
+namespace core::socket::stream {
+
+    // Block size of one direction of a connection. It doubles whenever a transfer fills a whole block and halves after
+    // ADAPTIVEBLOCKSIZE_SHRINK_AFTER consecutive transfers which used less than a quarter of a block.
+    // Without limits set the block size stays fixed.
+    class AdaptiveBlockSize {
+    public:
+        explicit AdaptiveBlockSize(std::size_t blockSize);
+
+        void setLimits(std::size_t minBlockSize, std::size_t maxBlockSize);
+
+        void transferred(std::size_t requested, std::size_t done);
+
+        std::size_t get() const;
+        std::size_t getMin() const;
+        void set(std::size_t blockSize); // fixed block size
+
+    private:
+        std::size_t blockSize;
+
+        std::size_t minBlockSize;
+        std::size_t maxBlockSize;
+
+        int smallTransfers = 0;
+    };
+
+} // namespace core::socket::stream
+
+#endif // CORE_SOCKET_STREAM_ADAPTIVEBLOCKSIZE_H
@@ -0,0 +1,232 @@
+/*
+ * snode.c - a slim toolkit for network communication
+ * Copyright (C) 2020, 2021, 2022 Volker Christian <me@vchrist.at>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/socket/stream/BufferChain.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include "core/system/unistd.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core::socket::stream {
+
+    thread_local BufferChain::FreeList BufferChain::freeList;
+
+    BufferChain::Segment::~Segment() {
+        if (fd >= 0) {
+            core::system::close(fd);
+        }
+    }
+
+    BufferChain::FreeList::~FreeList() {
+        while (head != nullptr) {
+            PooledSegment* segment = head;
+            head = static_cast<PooledSegment*>(head->next);
+            delete segment;
+        }
+    }
+
+    BufferChain::Segment* BufferChain::FreeList::acquire() {
+        PooledSegment* segment = head;
+
+        if (segment != nullptr) {
+            head = static_cast<PooledSegment*>(segment->next);
+            count--;
+
+            segment->next = nullptr;
+            segment->begin = 0;
+            segment->end = 0;
+        } else {
+            segment = new PooledSegment;
+        }
+
+        return segment;
+    }
+
+    void BufferChain::FreeList::release(Segment* segment) {
+        if (!segment->pooled) {
+            delete segment;
+        } else if (count < BUFFERCHAIN_FREELIST_MAX) {
+            segment->next = head;
+            head = static_cast<PooledSegment*>(segment);
+            count++;
+        } else {
+            delete static_cast<PooledSegment*>(segment);
+        }
+    }
+
+    BufferChain::~BufferChain() {
+        clear();
+    }
+
+    void BufferChain::append(const char* junk, std::size_t junkLen) {
+        while (junkLen > 0) {
+            if (tail == nullptr || tail->end == tail->capacity) {
+                push(freeList.acquire());
+            }
+
+            std::size_t copyLen = std::min(junkLen, tail->capacity - tail->end);
+            std::memcpy(static_cast<PooledSegment*>(tail)->storage + tail->end, junk, copyLen);
+
+            tail->end += copyLen;
+            totalSize += copyLen;
+
+            junk += copyLen;
+            junkLen -= copyLen;
+        }
+    }
+
+    void BufferChain::append(std::string&& data) {
+        if (data.size() < BUFFERCHAIN_ADOPT_MIN) {
+            append(data.data(), data.size());
+        } else {
+            std::shared_ptr<const std::string> owner = std::make_shared<const std::string>(std::move(data));
+            adopt(owner, owner->data(), owner->size());
+        }
+    }
+
+    void BufferChain::append(std::vector<char>&& data) {
+        if (data.size() < BUFFERCHAIN_ADOPT_MIN) {
+            append(data.data(), data.size());
+        } else {
+            std::shared_ptr<const std::vector<char>> owner = std::make_shared<const std::vector<char>>(std::move(data));
+            adopt(owner, owner->data(), owner->size());
+        }
+    }
+
+    void BufferChain::append(const std::shared_ptr<const std::string>& data) {
+        if (data->size() < BUFFERCHAIN_ADOPT_MIN) {
+            append(data->data(), data->size());
+        } else {
+            adopt(data, data->data(), data->size());
+        }
+    }
+
+    void BufferChain::adopt(const std::shared_ptr<const void>& owner, const char* junk, std::size_t junkLen) {
+        Segment* segment = new Segment;
+
+        segment->data = junk;
+        segment->end = junkLen;
+        segment->capacity = junkLen;
+        segment->owner = owner;
+
+        push(segment);
+        totalSize += junkLen;
+    }
+
+    void BufferChain::appendFile(int fd, off_t offset, std::size_t count) {
+        if (count > 0) {
+            Segment* segment = new Segment;
+
+            segment->fd = fd;
+            segment->begin = static_cast<std::size_t>(offset);
+            segment->end = segment->begin + count;
+            segment->capacity = segment->end;
+
+            push(segment);
+            totalSize += count;
+        } else {
+            core::system::close(fd);
+        }
+    }
+
+    void BufferChain::push(Segment* segment) {
+        if (tail != nullptr) {
+            tail->next = segment;
+        } else {
+            head = segment;
+        }
+        tail = segment;
+    }
+
+    int BufferChain::getIoVec(iovec* iov, int iovMax, std::size_t maxLen) const {
+        int iovCount = 0;
+
+        for (Segment* segment = head; segment != nullptr && segment->fd < 0 && iovCount < iovMax && maxLen > 0;
+             segment = segment->next) {
+            std::size_t segmentLen = std::min(segment->end - segment->begin, maxLen);
+
+            iov[iovCount].iov_base = const_cast<char*>(segment->data + segment->begin);
+            iov[iovCount].iov_len = segmentLen;
+            iovCount++;
+
+            maxLen -= segmentLen;
+        }
+
+        return iovCount;
+    }
+
+    int BufferChain::getFile(off_t& offset, std::size_t& count) const {
+        int fd = -1;
+
+        if (head != nullptr && head->fd >= 0) {
+            fd = head->fd;
+            offset = static_cast<off_t>(head->begin);
+            count = head->end - head->begin;
+        }
+
+        return fd;
+    }
+
+    void BufferChain::consume(std::size_t len) {
+        len = std::min(len, totalSize);
+        totalSize -= len;
+
+        while (len > 0) {
+            std::size_t segmentLen = std::min(head->end - head->begin, len);
+
+            head->begin += segmentLen;
+            len -= segmentLen;
+
+            if (head->begin == head->end) {
+                Segment* segment = head;
+                head = head->next;
+                freeList.release(segment);
+            }
+        }
+
+        if (head == nullptr) {
+            tail = nullptr;
+        }
+    }
+
+    void BufferChain::clear() {
+        while (head != nullptr) {
+            Segment* segment = head;
+            head = head->next;
+            freeList.release(segment);
+        }
+
+        tail = nullptr;
+        totalSize = 0;
+    }
+
+    bool BufferChain::empty() const {
+        return totalSize == 0;
+    }
+
+    std::size_t BufferChain::size() const {
+        return totalSize;
+    }
+
+} // namespace core::socket::stream
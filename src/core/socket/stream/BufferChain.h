@@ -0,0 +1,128 @@
+/*
+ * snode.c - a slim toolkit for network communication
+ * Copyright (C) 2020, 2021, 2022 Volker Christian <me@vchrist.at>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CORE_SOCKET_STREAM_BUFFERCHAIN_H
+#define CORE_SOCKET_STREAM_BUFFERCHAIN_H
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <sys/types.h>
+#include <sys/uio.h> // IWYU pragma: export
+#include <vector>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+#ifndef BUFFERCHAIN_SEGMENT_SIZE
+#define BUFFERCHAIN_SEGMENT_SIZE 16384
+#endif
+
+#ifndef BUFFERCHAIN_FREELIST_MAX
+#define BUFFERCHAIN_FREELIST_MAX 64
+#endif
+
+#ifndef BUFFERCHAIN_ADOPT_MIN
+#define BUFFERCHAIN_ADOPT_MIN 4096
+#endif
+
+namespace core::socket::stream {
+
+    // Queue of fixed-size segments. Consumed segments are recycled through a free list of the event loop (thread) they are used in.
+    // Buffers handed over by ownership are queued as they are and released as soon as they have been consumed completely.
+    // File segments carry an owned fd and a range of file offsets which are sent by the kernel directly.
+    class BufferChain {
+        BufferChain(const BufferChain&) = delete;
+        BufferChain& operator=(const BufferChain&) = delete;
+
+    public:
+        static constexpr std::size_t SEGMENT_SIZE = BUFFERCHAIN_SEGMENT_SIZE;
+        static constexpr int MAX_IOV = 64;
+
+        BufferChain() = default;
+        ~BufferChain();
+
+        void append(const char* junk, std::size_t junkLen);
+        void append(std::string&& data);
+        void append(std::vector<char>&& data);
+        void append(const std::shared_ptr<const std::string>& data);
+        void appendFile(int fd, off_t offset, std::size_t count);
+
+        // Fills at most iovMax entries covering at most maxLen bytes from the front and returns the number of entries used.
+        // Stops at the first file segment
+        int getIoVec(iovec* iov, int iovMax, std::size_t maxLen) const;
+
+        // Returns the fd of the front segment if it is a file segment, -1 otherwise
+        int getFile(off_t& offset, std::size_t& count) const;
+
+        void consume(std::size_t len);
+        void clear();
+
+        bool empty() const;
+        std::size_t size() const;
+
+    private:
+        struct Segment {
+            ~Segment();
+
+            Segment* next = nullptr;
+            const char* data = nullptr;
+            std::size_t begin = 0;
+            std::size_t end = 0;
+            std::size_t capacity = 0;
+            std::shared_ptr<const void> owner; // set for adopted buffers
+            int fd = -1;                       // set for file segments
+            bool pooled = false;
+        };
+
+        struct PooledSegment : Segment {
+            PooledSegment() {
+                data = storage;
+                capacity = SEGMENT_SIZE;
+                pooled = true;
+            }
+
+            char storage[SEGMENT_SIZE];
+        };
+
+        class FreeList {
+        public:
+            ~FreeList();
+
+            Segment* acquire();
+            void release(Segment* segment);
+
+        private:
+            PooledSegment* head = nullptr;
+            std::size_t count = 0;
+        };
+
+        void adopt(const std::shared_ptr<const void>& owner, const char* junk, std::size_t junkLen);
+        void push(Segment* segment);
+
+        static thread_local FreeList freeList;
+
+        Segment* head = nullptr;
+        Segment* tail = nullptr;
+        std::size_t totalSize = 0;
+    };
+
+} // namespace core::socket::stream
+
+#endif // CORE_SOCKET_STREAM_BUFFERCHAIN_H
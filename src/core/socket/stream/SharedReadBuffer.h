@@ -0,0 +1,45 @@
+/*
+ * snode.c - a slim toolkit for network communication
+ * Copyright (C) 2020, 2021, 2022 Volker Christian <me@vchrist.at>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CORE_SOCKET_STREAM_SHAREDREADBUFFER_H
+#define CORE_SOCKET_STREAM_SHAREDREADBUFFER_H
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <cstddef>
+#include <vector>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core::socket::stream {
+
+    // Scratch buffer all connections of an event loop (thread) read into if they do not own a read buffer.
+    // Its content is valid only until the next connection of the same event loop reads.
+    class SharedReadBuffer {
+    public:
+        SharedReadBuffer() = delete;
+
+        static char* get(std::size_t size);
+
+    private:
+        static thread_local std::vector<char> buffer;
+    };
+
+} // namespace core::socket::stream
+
+#endif // CORE_SOCKET_STREAM_SHAREDREADBUFFER_H
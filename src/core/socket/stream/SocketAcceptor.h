@@ -19,8 +19,12 @@
 #ifndef CORE_SOCKET_STREAM_SOCKETACCEPTOR_H
 #define CORE_SOCKET_STREAM_SOCKETACCEPTOR_H
 
+#include "core/EventLoop.h"
 #include "core/eventreceiver/AcceptEventReceiver.h"
+#include "core/eventreceiver/ReadEventReceiver.h"
+#include "core/socket/stream/AcceptorStatistics.h"
 #include "core/socket/stream/SocketConnectionFactory.h"
+#include "core/timer/Timer.h"
 #include "net/config/ConfigCluster.h"
 #include "net/un/dgram/Socket.h"
 
@@ -30,13 +34,25 @@ namespace core::socket {
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
+#include "core/system/poll.h"
+#include "core/system/socket.h"
+#include "core/system/unistd.h"
 #include "log/Logger.h"
+#include "utils/Cluster.h"
+#include "utils/Config.h"
 
 #include <any>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
 #include <functional>
 #include <map>
 #include <memory>
 #include <string>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
@@ -45,7 +61,8 @@ namespace core::socket::stream {
     template <typename SocketServerT, template <typename SocketT> class SocketConnectionT>
     class SocketAcceptor
         : protected core::eventreceiver::InitAcceptEventReceiver
-        , protected core::eventreceiver::AcceptEventReceiver {
+        , protected core::eventreceiver::AcceptEventReceiver
+        , protected core::eventreceiver::ReadEventReceiver {
         SocketAcceptor() = delete;
         SocketAcceptor(const SocketAcceptor&) = delete;
         SocketAcceptor& operator=(const SocketAcceptor&) = delete;
@@ -55,6 +72,12 @@ namespace core::socket::stream {
         using PrimarySocket = typename SocketServer::Socket;
         using SecondarySocket = net::un::dgram::Socket;
 
+        struct ControlMessage {
+            enum : std::uint32_t { LOAD, HANDOVER, DRAIN } type;
+            std::uint32_t index;
+            std::uint32_t value; // Connections of worker index or pid of the instance taking over
+        };
+
     protected:
         using SocketConnection = SocketConnectionT<PrimarySocket>;
         using SocketConnectionFactory = core::socket::stream::SocketConnectionFactory<SocketServer, SocketConnection>;
@@ -75,12 +98,46 @@ namespace core::socket::stream {
                        const std::map<std::string, std::any>& options)
             : core::eventreceiver::InitAcceptEventReceiver("SocketAcceptor")
             , core::eventreceiver::AcceptEventReceiver("SocketAcceptor")
-            , socketConnectionFactory(socketContextFactory, onConnect, onConnected, onDisconnect)
+            , core::eventreceiver::ReadEventReceiver("SocketAcceptor cluster", core::DescriptorEventReceiver::TIMEOUT::DISABLE)
+            , statistics(getStatistics(options))
+            , socketConnectionFactory(
+                  socketContextFactory,
+                  [onConnect, connections = this->connections, statistics = this->statistics](SocketConnection* socketConnection) -> void {
+                      ++connections->active;
+                      ++statistics->active;
+                      onConnect(socketConnection);
+                  },
+                  onConnected,
+                  [onDisconnect, connections = this->connections, statistics = this->statistics](
+                      SocketConnection* socketConnection) -> void {
+                      --connections->active;
+                      --statistics->active;
+                      onDisconnect(socketConnection);
+
+                      if (connections->acceptor != nullptr) {
+                          connections->acceptor->connectionClosed();
+                      }
+                  })
             , options(options) {
+            connections->acceptor = this;
         }
 
         ~SocketAcceptor() override {
+            connections->acceptor = nullptr;
+
+            if (overloadTimer != nullptr) {
+                overloadTimer->cancel();
+                delete overloadTimer;
+            }
+            if (spareFd >= 0) {
+                core::system::close(spareFd);
+            }
+            if (listening) {
+                core::EventLoop::listenerRemoved(handedOver);
+            }
+            cancelClusterTimer();
             if (secondarySocket != nullptr) {
+                (void) std::remove(secondarySocket->getBindAddress().address().data());
                 delete secondarySocket;
             }
             if (primarySocket != nullptr) {
@@ -101,96 +158,523 @@ namespace core::socket::stream {
                 config->getClusterMode() == net::config::ConfigCluster::MODE::PRIMARY) {
                 VLOG(0) << "Mode: STANDALONE or PRIMARY";
 
-                primarySocket = new PrimarySocket();
-                if (primarySocket->open(PrimarySocket::Flags::NONBLOCK) < 0) {
-                    onError(config->getLocalAddress(), errno);
-                    destruct();
+                if (utils::Config::getRestartPid() > 0 && takeOver()) {
+                    VLOG(0) << "    Listening socket taken over from pid " << utils::Config::getRestartPid();
+                    startAccepting();
+                } else {
+                    primarySocket = new PrimarySocket();
+                    if (primarySocket->open(PrimarySocket::Flags::NONBLOCK) < 0) {
+                        onError(config->getLocalAddress(), errno);
+                        destruct();
 #if !defined(NDEBUG)
-                } else if (primarySocket->reuseAddress() < 0) {
-                    onError(config->getLocalAddress(), errno);
-                    destruct();
+                    } else if (primarySocket->reuseAddress() < 0) {
+                        onError(config->getLocalAddress(), errno);
+                        destruct();
 #endif // !defined(NDEBUG)
-                } else if (primarySocket->bind(config->getLocalAddress()) < 0) {
-                    onError(config->getLocalAddress(), errno);
-                    destruct();
-                } else if (primarySocket->listen(config->getBacklog()) < 0) {
-                    onError(config->getLocalAddress(), errno);
-                    destruct();
-                } else if (config->getClusterMode() == net::config::ConfigCluster::MODE::PRIMARY) {
-                    VLOG(0) << "    Cluster: PRIMARY";
-                    secondarySocket = new SecondarySocket();
-                    if (secondarySocket->open(SecondarySocket::Flags::NONBLOCK) < 0) {
+                    } else if (config->getEventLoops() > 1 && primarySocket->reusePort() < 0) {
+                        onError(config->getLocalAddress(), errno);
+                        destruct();
+                    } else if (setSocketOptions() < 0) {
                         onError(config->getLocalAddress(), errno);
                         destruct();
-                    } else if (secondarySocket->bind(SecondarySocket::SocketAddress("/tmp/primary")) < 0) {
+                    } else if (primarySocket->bind(config->getLocalAddress()) < 0) {
+                        onError(config->getLocalAddress(), errno);
+                        destruct();
+                    } else if (primarySocket->listen(config->getBacklog()) < 0) {
                         onError(config->getLocalAddress(), errno);
                         destruct();
                     } else {
-                        onError(config->getLocalAddress(), 0);
-                        enable(primarySocket->getFd());
+                        startAccepting();
                     }
-                } else {
-                    VLOG(0) << "    Cluster: NONE";
-                    onError(config->getLocalAddress(), 0);
-                    enable(primarySocket->getFd());
                 }
             } else if (config->getClusterMode() == net::config::ConfigCluster::MODE::SECONDARY ||
                        config->getClusterMode() == net::config::ConfigCluster::MODE::PROXY) {
-                VLOG(0) << "    Mode: SECONDARY or PROXY";
-                secondarySocket = new SecondarySocket();
-                if (secondarySocket->open(SecondarySocket::Flags::NONBLOCK) < 0) {
-                    onError(config->getLocalAddress(), errno);
+                VLOG(0) << "    Mode: SECONDARY (worker " << utils::Cluster::getWorkerIndex() << ")";
+                if (!utils::Cluster::isWorker()) {
+                    LOG(ERROR) << "Cluster: SECONDARY instances are started by their PRIMARY";
+                    onError(config->getLocalAddress(), EINVAL);
                     destruct();
-                } else if (secondarySocket->bind(SecondarySocket::SocketAddress("/tmp/secondary")) < 0) {
+                } else if (openControlSocket(std::to_string(utils::Cluster::getWorkerIndex())) < 0) {
                     onError(config->getLocalAddress(), errno);
                     destruct();
                 } else {
-                    onError(config->getLocalAddress(), errno);
-                    enable(secondarySocket->getFd());
+                    SecondarySocket::SocketAddress primaryAddress(getControlSocketPath(utils::Cluster::getPrimaryPid(), "control"));
+
+                    if (core::system::connect(secondarySocket->getFd(), primaryAddress, primaryAddress.getAddrLen()) < 0) {
+                        PLOG(ERROR) << "Cluster: Connecting to PRIMARY " << primaryAddress.address();
+                    } else {
+                        reportLoad();
+                    }
+
+                    clusterTimer = new core::timer::Timer(core::timer::Timer::intervalTimer(
+                        [this]([[maybe_unused]] const void* arg) -> void {
+                            reportLoad();
+                        },
+                        config->getClusterHeartbeat(),
+                        nullptr));
+
+                    listening = true;
+                    core::EventLoop::listenerAdded();
+
+                    onError(config->getLocalAddress(), 0);
+                    AcceptEventReceiver::enable(secondarySocket->getFd());
+                }
+            }
+        }
+
+        void startAccepting() {
+            // The control socket receives load reports of the workers and hand over requests of a restarted instance. Their senders
+            // are identified by the credentials the kernel attaches to each message (SO_PASSCRED)
+            int sockopt = 1;
+            const bool controlled = openControlSocket("control") >= 0 &&
+                                    secondarySocket->setSockopt(SOL_SOCKET, SO_PASSCRED, &sockopt, sizeof(sockopt)) >= 0;
+
+            if (config->getClusterMode() == net::config::ConfigCluster::MODE::PRIMARY) {
+                VLOG(0) << "    Cluster: PRIMARY";
+            } else {
+                VLOG(0) << "    Cluster: NONE";
+            }
+
+            if (!controlled && config->getClusterMode() == net::config::ConfigCluster::MODE::PRIMARY) {
+                onError(config->getLocalAddress(), errno);
+                destruct();
+            } else {
+                if (!controlled) {
+                    PLOG(WARNING) << "Restart: Control socket not available. The listening socket can not be handed over";
+                    delete secondarySocket;
+                    secondarySocket = nullptr;
+                }
+
+                if (config->getClusterMode() == net::config::ConfigCluster::MODE::PRIMARY) {
+                    std::size_t workerCount = utils::Cluster::spawnWorkers(config->getClusterWorkers());
+                    if (config->getClusterWorkers() > 0 && config->getClusterWorkers() < workerCount) {
+                        workerCount = config->getClusterWorkers();
+                    }
+
+                    for (std::size_t index = 0; index < workerCount; index++) {
+                        workers.push_back(Worker{
+                            SecondarySocket::SocketAddress(getControlSocketPath(utils::Cluster::getPrimaryPid(), std::to_string(index)))});
+                    }
+
+                    clusterTimer = new core::timer::Timer(core::timer::Timer::intervalTimer(
+                        [this]([[maybe_unused]] const void* arg) -> void {
+                            checkWorkers();
+                        },
+                        config->getClusterHeartbeat(),
+                        nullptr));
+                }
+
+                // Given up to accept and close a connection when the process runs out of descriptors
+                spareFd = core::system::open("/dev/null", O_RDONLY | O_CLOEXEC);
+
+                listening = true;
+                core::EventLoop::listenerAdded();
+
+                onError(config->getLocalAddress(), 0);
+                AcceptEventReceiver::enable(primarySocket->getFd());
+                if (secondarySocket != nullptr) {
+                    ReadEventReceiver::enable(secondarySocket->getFd());
                 }
             }
         }
 
+        // Asks the instance being restarted for its listening socket of this instance and event loop
+        bool takeOver() {
+            bool takenOver = false;
+
+            try {
+                SecondarySocket::SocketAddress takeOverAddress(getControlSocketPath(getpid(), "takeover"));
+                SecondarySocket::SocketAddress controlAddress(getControlSocketPath(utils::Config::getRestartPid(), "control"));
+
+                SecondarySocket takeOverSocket;
+                if (takeOverSocket.open() >= 0) {
+                    (void) std::remove(takeOverAddress.address().data());
+
+                    if (takeOverSocket.bind(takeOverAddress) >= 0) {
+                        ControlMessage controlMessage{ControlMessage::HANDOVER, 0, static_cast<std::uint32_t>(getpid())};
+                        pollfd pollFd{takeOverSocket.getFd(), POLLIN, 0};
+                        int fd = -1;
+
+                        if (core::system::connect(takeOverSocket.getFd(), controlAddress, controlAddress.getAddrLen()) == 0 &&
+                            core::system::send(takeOverSocket.getFd(), &controlMessage, sizeof(controlMessage), 0) ==
+                                static_cast<ssize_t>(sizeof(controlMessage)) &&
+                            core::system::poll(&pollFd, 1, HANDOVER_TIMEOUT) == 1 && takeOverSocket.recvFd(&fd) >= 0) {
+                            primarySocket = new PrimarySocket(fd);
+                            takenOver = true;
+                        } else {
+                            PLOG(WARNING) << "Restart: Taking over the listening socket from " << controlAddress.address();
+                        }
+
+                        (void) std::remove(takeOverAddress.address().data());
+                    }
+                }
+            } catch (const net::un::bad_sunpath& badSunPath) {
+                LOG(ERROR) << badSunPath.what();
+            }
+
+            return takenOver;
+        }
+
+        void handOver(pid_t pid) {
+            try {
+                SecondarySocket::SocketAddress takeOverAddress(getControlSocketPath(pid, "takeover"));
+
+                if (secondarySocket->sendFd(takeOverAddress, primarySocket->getFd()) >= 0) {
+                    LOG(INFO) << "Restart: Listening socket of " << config->getName() << " handed over to pid " << pid;
+
+                    // Connections not yet accepted are left to the new instance. Established ones keep being served
+                    handedOver = true;
+                    AcceptEventReceiver::disable();
+                    ReadEventReceiver::disable();
+
+                    if (config->getClusterMode() == net::config::ConfigCluster::MODE::PRIMARY) {
+                        drainWorkers();
+                    }
+                } else {
+                    PLOG(WARNING) << "Restart: Handing over the listening socket to pid " << pid;
+                }
+            } catch (const net::un::bad_sunpath& badSunPath) {
+                LOG(ERROR) << badSunPath.what();
+            }
+        }
+
         void acceptEvent() override {
+            int acceptsPerTick = config->getAcceptsPerTick();
+
             if (config->getClusterMode() == net::config::ConfigCluster::MODE::NONE ||
                 config->getClusterMode() == net::config::ConfigCluster::MODE::PRIMARY) {
-                PrimarySocket socket;
-
-                int acceptsPerTick = config->getAcceptsPerTick();
+                bool accepted = false;
 
                 do {
+                    if (atConnectionLimit()) {
+                        pauseAccepting();
+                        break;
+                    }
+
                     SocketAddress remoteAddress{};
-                    socket = primarySocket->accept4(remoteAddress, SOCK_NONBLOCK);
-                    if (socket.isValid()) {
-                        if (config->getClusterMode() == net::config::ConfigCluster::MODE::NONE) {
+                    const int fd = primarySocket->accept4(remoteAddress, SOCK_NONBLOCK);
+                    const int acceptErrno = errno;
+
+                    PrimarySocket socket(fd);
+                    errno = acceptErrno; // not preserved by the socket constructor
+
+                    accepted = socket.isValid();
+                    if (accepted) {
+                        ++statistics->accepted;
+
+                        // Connections no worker is able to take are served by the PRIMARY itself
+                        if (config->getClusterMode() == net::config::ConfigCluster::MODE::NONE || !dispatchToWorker(socket)) {
                             socketConnectionFactory.create(socket, config);
-                        } else {
-                            // Send descriptor to SECONDARY
-                            VLOG(0) << "Sending to secondary";
-                            secondarySocket->sendFd(SecondarySocket::SocketAddress("/tmp/secondary"), socket.getFd());
-                            SecondarySocket::SocketAddress address;
                         }
+                    } else if (errno == EMFILE || errno == ENFILE) {
+                        PLOG(WARNING) << "accept";
+                        shedConnection();
                     } else if (errno != EINTR && errno != EAGAIN && errno != EWOULDBLOCK) {
                         PLOG(ERROR) << "accept";
                     }
-                } while (--acceptsPerTick > 0 && socket.isValid());
+                } while (--acceptsPerTick > 0 && accepted);
             } else if (config->getClusterMode() == net::config::ConfigCluster::MODE::SECONDARY ||
                        config->getClusterMode() == net::config::ConfigCluster::MODE::PROXY) {
                 // Receive socketfd via SOCK_UNIX, SOCK_DGRAM
-                int fd = -1;
+                ssize_t received = 0;
 
-                if (secondarySocket->recvFd(&fd) >= 0) {
-                    PrimarySocket socket(fd);
+                do {
+                    if (atConnectionLimit()) {
+                        pauseAccepting();
+                        break;
+                    }
+
+                    int fd = -1;
+
+                    received = secondarySocket->recvFd(&fd);
+                    if (received >= 0) {
+                        ++statistics->accepted;
+
+                        PrimarySocket socket(fd);
 
-                    if (config->getClusterMode() == net::config::ConfigCluster::MODE::SECONDARY) {
                         socketConnectionFactory.create(socket, config);
-                    } else { // PROXY
-                        // Send to SECONDARY (TERTIARY)
+                    } else if (errno == ENOMSG) {
+                        // A datagram without descriptor: the PRIMARY handed its listening socket over to a restarted instance
+                        drain();
+                        break;
+                    } else if (errno != EINTR && errno != EAGAIN && errno != EWOULDBLOCK) {
+                        PLOG(ERROR) << "read_fd";
+                    }
+                } while (--acceptsPerTick > 0 && received >= 0);
+
+                reportLoad();
+            }
+        }
+
+        // Load reports of the workers and hand over requests
+        void readEvent() override {
+            ControlMessage controlMessage{};
+            ucred credentials{};
+
+            while (!handedOver && recvControlMessage(controlMessage, credentials) == static_cast<ssize_t>(sizeof(controlMessage))) {
+                switch (controlMessage.type) {
+                    case ControlMessage::LOAD:
+                        if (controlMessage.index < workers.size()) {
+                            Worker& worker = workers[controlMessage.index];
+
+                            worker.connections = controlMessage.value;
+                            worker.lastReport = core::EventLoop::getCurrentTime();
+
+                            if (!worker.healthy && utils::Cluster::isWorkerAlive(controlMessage.index)) {
+                                VLOG(0) << "Cluster: Worker " << controlMessage.index << " serving";
+                                worker.healthy = true;
+                            }
+                        }
+                        break;
+                    case ControlMessage::HANDOVER:
+                        // Only a process of the same user may take over and only for itself
+                        if (credentials.uid == geteuid() && credentials.pid == static_cast<pid_t>(controlMessage.value)) {
+                            handOver(credentials.pid);
+                        } else {
+                            LOG(WARNING) << "Restart: Hand over request of pid " << credentials.pid << " (uid " << credentials.uid
+                                         << ") rejected";
+                        }
+                        break;
+                    case ControlMessage::DRAIN:
+                        break;
+                }
+            }
+        }
+
+        ssize_t recvControlMessage(ControlMessage& controlMessage, ucred& credentials) {
+            union {
+                cmsghdr cm;
+                char control[CMSG_SPACE(sizeof(ucred))] = {};
+            } controlUn;
+
+            iovec iov{&controlMessage, sizeof(controlMessage)};
+
+            msghdr msg{};
+            msg.msg_iov = &iov;
+            msg.msg_iovlen = 1;
+            msg.msg_control = controlUn.control;
+            msg.msg_controllen = sizeof(controlUn.control);
+
+            credentials = {0, static_cast<uid_t>(-1), static_cast<gid_t>(-1)};
+
+            const ssize_t ret = core::system::recvmsg(secondarySocket->getFd(), &msg, 0);
+
+            const cmsghdr* cmsg = ret >= 0 ? CMSG_FIRSTHDR(&msg) : nullptr;
+            if (cmsg != nullptr && cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_CREDENTIALS &&
+                cmsg->cmsg_len == CMSG_LEN(sizeof(ucred))) {
+                std::memcpy(&credentials, CMSG_DATA(cmsg), sizeof(ucred));
+            }
+
+            return ret;
+        }
+
+        // Tells the workers to stop accepting. They end once their established connections are closed
+        void drainWorkers() {
+            cancelClusterTimer();
+
+            for (std::size_t index = 0; index < workers.size(); index++) {
+                ControlMessage controlMessage{ControlMessage::DRAIN, static_cast<std::uint32_t>(index), 0};
+
+                if (core::system::sendto(secondarySocket->getFd(),
+                                         &controlMessage,
+                                         sizeof(controlMessage),
+                                         0,
+                                         workers[index].address,
+                                         workers[index].address.getAddrLen()) < 0) {
+                    PLOG(WARNING) << "Cluster: Draining worker " << index;
+                }
+            }
+
+            utils::Cluster::drainWorkers();
+        }
+
+        void drain() {
+            VLOG(0) << "Cluster: Worker " << utils::Cluster::getWorkerIndex() << " draining";
+
+            handedOver = true;
+            cancelClusterTimer();
+            AcceptEventReceiver::disable();
+        }
+
+        void cancelClusterTimer() {
+            if (clusterTimer != nullptr) {
+                clusterTimer->cancel();
+                delete clusterTimer;
+                clusterTimer = nullptr;
+            }
+        }
+
+        int openControlSocket(const std::string& name) {
+            int ret = -1;
+
+            try {
+                SecondarySocket::SocketAddress controlAddress(getControlSocketPath(utils::Cluster::getPrimaryPid(), name));
+
+                secondarySocket = new SecondarySocket();
+                if (secondarySocket->open(SecondarySocket::Flags::NONBLOCK) >= 0) {
+                    (void) std::remove(controlAddress.address().data());
+
+                    ret = secondarySocket->bind(controlAddress);
+                }
+            } catch (const net::un::bad_sunpath& badSunPath) {
+                LOG(ERROR) << badSunPath.what();
+                errno = ENAMETOOLONG;
+            }
+
+            return ret;
+        }
+
+        // One socket per process, application instance, event loop and cluster member
+        std::string getControlSocketPath(pid_t pid, const std::string& name) const {
+            return config->getClusterSocketDir() + "/" + utils::Config::getApplicationName() + "-" + std::to_string(pid) + "-" +
+                   config->getName() + "-" +
+                   std::to_string(core::EventLoop::getEventLoopIndex()) + "-" + name;
+        }
+
+        bool dispatchToWorker(PrimarySocket& socket) {
+            bool dispatched = false;
+
+            for (std::size_t tries = 0; tries < workers.size() && !dispatched; tries++) {
+                const std::size_t index = selectWorker();
+
+                if (index < workers.size()) {
+                    Worker& worker = workers[index];
+
+                    if (secondarySocket->sendFd(worker.address, socket.getFd()) >= 0) {
+                        // Accounted until the next load report of the worker corrects it
+                        worker.connections++;
+                        dispatched = true;
+                    } else {
+                        // A full receive queue means the worker is overloaded. It rejoins with its next load report
+                        if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                            PLOG(WARNING) << "Cluster: Sending to worker " << index;
+                        }
+                        worker.healthy = false;
                     }
                 } else {
-                    PLOG(ERROR) << "read_fd";
+                    break;
+                }
+            }
+
+            return dispatched;
+        }
+
+        std::size_t selectWorker() {
+            std::size_t selected = workers.size();
+
+            for (std::size_t count = 0; count < workers.size(); count++) {
+                const std::size_t index = (nextWorker + count) % workers.size();
+
+                if (workers[index].healthy) {
+                    if (selected == workers.size()) {
+                        selected = index;
+
+                        if (config->getClusterBalance() == net::config::ConfigCluster::BALANCE::ROUND_ROBIN) {
+                            break;
+                        }
+                    } else if (workers[index].connections < workers[selected].connections) {
+                        selected = index;
+                    }
                 }
             }
+
+            if (selected < workers.size()) {
+                nextWorker = selected + 1;
+            }
+
+            return selected;
+        }
+
+        void checkWorkers() {
+            utils::Cluster::reapWorkers();
+
+            const utils::Timeval heartbeat = config->getClusterHeartbeat();
+            const utils::Timeval deadline = core::EventLoop::getCurrentTime() - heartbeat - heartbeat - heartbeat;
+
+            for (std::size_t index = 0; index < workers.size(); index++) {
+                Worker& worker = workers[index];
+
+                if (worker.healthy && (worker.lastReport < deadline || !utils::Cluster::isWorkerAlive(index))) {
+                    LOG(WARNING) << "Cluster: Worker " << index << " removed";
+                    worker.healthy = false;
+                }
+            }
+        }
+
+        void reportLoad() {
+            ControlMessage controlMessage{ControlMessage::LOAD,
+                                          static_cast<std::uint32_t>(utils::Cluster::getWorkerIndex()),
+                                          static_cast<std::uint32_t>(connections->active)};
+
+            core::system::send(secondarySocket->getFd(), &controlMessage, sizeof(controlMessage), 0);
+        }
+
+        static std::shared_ptr<AcceptorStatistics> getStatistics(const std::map<std::string, std::any>& options) {
+            auto it = options.find("ACCEPTOR_STATISTICS");
+
+            return it != options.end() ? std::any_cast<std::shared_ptr<AcceptorStatistics>>(it->second)
+                                       : std::make_shared<AcceptorStatistics>();
+        }
+
+        bool atConnectionLimit() const {
+            return config->getMaxConnections() > 0 && connections->active >= static_cast<std::size_t>(config->getMaxConnections());
+        }
+
+        // Pending connections stay in the listen backlog until accepting is resumed
+        void pauseAccepting() {
+            if (!AcceptEventReceiver::isSuspended()) {
+                AcceptEventReceiver::suspend();
+                ++statistics->paused;
+            }
+        }
+
+        void resumeAccepting() {
+            if (overloadTimer != nullptr) {
+                overloadTimer->cancel();
+                delete overloadTimer;
+                overloadTimer = nullptr;
+            }
+
+            if (AcceptEventReceiver::isEnabled() && AcceptEventReceiver::isSuspended()) {
+                AcceptEventReceiver::resume();
+            }
+        }
+
+        void connectionClosed() {
+            if (AcceptEventReceiver::isSuspended() && !atConnectionLimit()) {
+                resumeAccepting();
+            }
+        }
+
+        // Out of descriptors the pending connection would be reported on every tick. Thus the spare descriptor is released to
+        // accept and close it and accepting pauses until a connection closes or OVERLOAD_RETRY has passed
+        void shedConnection() {
+            if (spareFd >= 0) {
+                core::system::close(spareFd);
+
+                SocketAddress remoteAddress{};
+                PrimarySocket socket(primarySocket->accept4(remoteAddress, SOCK_NONBLOCK));
+                if (socket.isValid()) {
+                    ++statistics->rejected;
+                }
+                socket.close();
+
+                spareFd = core::system::open("/dev/null", O_RDONLY | O_CLOEXEC);
+            }
+
+            pauseAccepting();
+
+            if (overloadTimer == nullptr) {
+                overloadTimer = new core::timer::Timer(core::timer::Timer::singleshotTimer(
+                    [this]([[maybe_unused]] const void* arg) -> void {
+                        delete overloadTimer;
+                        overloadTimer = nullptr;
+
+                        resumeAccepting();
+                    },
+                    OVERLOAD_RETRY,
+                    nullptr));
+            }
         }
 
     protected:
@@ -207,16 +691,72 @@ namespace core::socket::stream {
             return primarySocket->setSockopt(SOL_SOCKET, SO_REUSEADDR, &sockopt, sizeof(sockopt));
         }
 
+        // Set on the listening socket before listen(): accepted connections inherit them
+        int setSocketOptions() {
+            int ret = 0;
+
+            if (config->getTcpNoDelay() && primarySocket->isTcp()) {
+                ret = primarySocket->setTcpNoDelay(true);
+            }
+            if (ret == 0 && config->getSendBufferSize() > 0) {
+                ret = primarySocket->setSendBufferSize(config->getSendBufferSize());
+            }
+            if (ret == 0 && config->getReceiveBufferSize() > 0) {
+                ret = primarySocket->setReceiveBufferSize(config->getReceiveBufferSize());
+            }
+            if (ret == 0 && config->getSocketBusyPoll() > 0) {
+                ret = primarySocket->setBusyPoll(config->getSocketBusyPoll());
+            }
+            if (ret == 0 && config->getTcpFastOpen() > 0 && primarySocket->isTcp()) {
+                ret = primarySocket->setTcpFastOpen(config->getTcpFastOpen());
+            }
+            if (ret == 0 && config->getTcpDeferAccept() > 0 && primarySocket->isTcp()) {
+                ret = primarySocket->setTcpDeferAccept(config->getTcpDeferAccept());
+            }
+
+            return ret;
+        }
+
         void unobservedEvent() override {
             destruct();
         }
 
+        static constexpr int HANDOVER_TIMEOUT = 1000; // ms
+        static constexpr double OVERLOAD_RETRY = 1;    // s
+
+        struct Worker {
+            SecondarySocket::SocketAddress address;
+            std::size_t connections = 0;
+            utils::Timeval lastReport{};
+            bool healthy = false;
+        };
+
+        std::vector<Worker> workers;
+        std::size_t nextWorker = 0;
+
+        core::timer::Timer* clusterTimer = nullptr;
+
+        core::timer::Timer* overloadTimer = nullptr;
+        int spareFd = -1;
+
+        bool listening = false;
+        bool handedOver = false;
+
     protected:
         std::function<void(const SocketAddress&, int)> onError = nullptr;
 
         PrimarySocket* primarySocket = nullptr;
         SecondarySocket* secondarySocket = nullptr;
 
+        // Connections of this acceptor still alive. Shared with the callbacks as they may outlive the acceptor
+        struct Connections {
+            std::size_t active = 0;
+            SocketAcceptor* acceptor = nullptr; // reset as soon as the acceptor is gone
+        };
+
+        std::shared_ptr<Connections> connections = std::make_shared<Connections>();
+        std::shared_ptr<AcceptorStatistics> statistics;
+
         SocketConnectionFactory socketConnectionFactory;
 
         std::map<std::string, std::any> options;
@@ -28,6 +28,11 @@
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <span>
+#include <string>
+#include <sys/types.h>
+#include <utility>
+#include <vector>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
@@ -58,7 +63,15 @@ namespace core::socket::stream {
                          const utils::Timeval& readTimeout,
                          const utils::Timeval& writeTimeout,
                          std::size_t readBlockSize,
+                         bool sharedReadBuffer,
+                         std::size_t readBudget,
+                         std::size_t readBudgetReads,
                          std::size_t writeBlockSize,
+                         bool adaptiveBlockSize,
+                         std::size_t minBlockSize,
+                         std::size_t maxBlockSize,
+                         std::size_t writeHighWatermark,
+                         std::size_t writeLowWatermark,
                          const utils::Timeval& terminateTimeout)
             : SocketReader(
                   [this](int errnum) -> void {
@@ -66,19 +79,36 @@ namespace core::socket::stream {
                   },
                   readTimeout,
                   readBlockSize,
+                  sharedReadBuffer,
                   terminateTimeout)
             , SocketWriter(
                   [this](int errnum) -> void {
                       onWriteError(errnum);
                   },
+                  [this](bool full) -> void {
+                      if (full) {
+                          onWriteBufferFull();
+                      } else {
+                          onWriteBufferDrained();
+                      }
+                  },
                   writeTimeout,
                   writeBlockSize,
+                  writeHighWatermark,
+                  writeLowWatermark,
                   terminateTimeout)
             , localAddress(localAddress)
             , remoteAddress(remoteAddress)
+            , readBudget(readBudget)
+            , readBudgetReads(readBudgetReads)
             , onDisconnect(onDisconnect) {
             SocketConnection::Descriptor::open(fd);
 
+            if (adaptiveBlockSize) {
+                SocketReader::setAdaptiveBlockSize(minBlockSize, maxBlockSize);
+                SocketWriter::setAdaptiveBlockSize(minBlockSize, maxBlockSize);
+            }
+
             setSocketContext(socketContextFactory.get());
 
             SocketReader::enable(fd);
@@ -151,6 +181,23 @@ namespace core::socket::stream {
             return ret;
         }
 
+        std::span<const char> peekFromPeer() final {
+            std::span<const char> unread;
+
+            if (newSocketContext == nullptr) {
+                unread = SocketReader::peek();
+            } else {
+                VLOG(0) << "PeekFromPeer: OldSocketContext != nullptr: SocketContextSwitch in progress";
+            }
+
+            return unread;
+        }
+
+        // Not guarded against a pending SocketContextSwitch: only bytes already peeked by the current context are consumed
+        std::size_t consumeFromPeer(std::size_t junkLen) final {
+            return SocketReader::consume(junkLen);
+        }
+
         void sendToPeer(const char* junk, std::size_t junkLen) final {
             if (newSocketContext == nullptr) {
                 SocketWriter::sendToPeer(junk, junkLen);
@@ -163,14 +210,65 @@ namespace core::socket::stream {
             sendToPeer(data.data(), data.size());
         }
 
+        void sendToPeer(std::string&& data) final {
+            if (newSocketContext == nullptr) {
+                SocketWriter::sendToPeer(std::move(data));
+            } else {
+                VLOG(0) << "SendToPeer: OldSocketContext != nullptr: SocketContextSwitch in progress";
+            }
+        }
+
+        void sendToPeer(std::vector<char>&& data) final {
+            if (newSocketContext == nullptr) {
+                SocketWriter::sendToPeer(std::move(data));
+            } else {
+                VLOG(0) << "SendToPeer: OldSocketContext != nullptr: SocketContextSwitch in progress";
+            }
+        }
+
+        void sendToPeer(const std::shared_ptr<const std::string>& data) final {
+            if (newSocketContext == nullptr) {
+                SocketWriter::sendToPeer(data);
+            } else {
+                VLOG(0) << "SendToPeer: OldSocketContext != nullptr: SocketContextSwitch in progress";
+            }
+        }
+
+        bool sendFileToPeer(int fd, off_t offset, std::size_t count) final {
+            bool sent = false;
+
+            if (newSocketContext == nullptr) {
+                sent = SocketWriter::sendFileToPeer(fd, offset, count);
+            } else {
+                VLOG(0) << "SendFileToPeer: OldSocketContext != nullptr: SocketContextSwitch in progress";
+            }
+
+            return sent;
+        }
+
     private:
+        // Reads and delivers at most readBudgetReads blocks and readBudget bytes (0: unlimited) per tick.
+        // The remaining data is read in one of the next ticks, thus one fast peer can not monopolize a tick.
         void readEvent() final {
-            std::size_t availble = SocketReader::doRead();
-            std::size_t consumed = onReceiveFromPeer();
+            std::size_t reads = 0;
+            std::size_t received = 0;
 
-            if (availble != 0 && consumed == 0) {
-                close();
-            }
+            bool proceed = false;
+            do {
+                std::size_t availble = SocketReader::doRead();
+                std::size_t consumed = onReceiveFromPeer();
+                SocketReader::retainUnconsumed();
+
+                if (availble != 0 && consumed == 0) {
+                    close();
+                }
+
+                reads++;
+                received += consumed;
+
+                proceed = availble != 0 && consumed == availble && reads < readBudgetReads &&
+                          (readBudget == 0 || received < readBudget) && SocketReader::isEnabled();
+            } while (proceed);
         }
 
         void writeEvent() final {
@@ -184,6 +282,9 @@ namespace core::socket::stream {
         SocketAddress localAddress{};
         SocketAddress remoteAddress{};
 
+        std::size_t readBudget;
+        std::size_t readBudgetReads;
+
         core::socket::SocketContext* newSocketContext = nullptr;
 
         std::function<void()> onDisconnect;
@@ -72,7 +72,15 @@ namespace core::socket::stream {
                                                      config->getReadTimeout(),
                                                      config->getWriteTimeout(),
                                                      config->getReadBlockSize(),
+                                                     config->getSharedReadBuffer(),
+                                                     config->getReadBudget(),
+                                                     config->getReadBudgetReads(),
                                                      config->getWriteBlockSize(),
+                                                     config->getAdaptiveBlockSize(),
+                                                     config->getMinBlockSize(),
+                                                     config->getMaxBlockSize(),
+                                                     config->getWriteHighWatermark(),
+                                                     config->getWriteLowWatermark(),
                                                      config->getTerminateTimeout()));
                 } else {
                     PLOG(ERROR) << "getsockname";
@@ -88,6 +88,9 @@ namespace core::socket::stream {
             if (socket->open(PrimarySocket::Flags::NONBLOCK) < 0) {
                 onError(config->getRemoteAddress(), errno);
                 destruct();
+            } else if (setSocketOptions() < 0) {
+                onError(config->getRemoteAddress(), errno);
+                destruct();
             } else if (socket->bind(config->getLocalAddress()) < 0) {
                 onError(config->getRemoteAddress(), errno);
                 destruct();
@@ -99,6 +102,26 @@ namespace core::socket::stream {
             }
         }
 
+        // Set before connect() as the receive buffer size determines the window scale offered in the SYN
+        int setSocketOptions() {
+            int ret = 0;
+
+            if (config->getTcpNoDelay() && socket->isTcp()) {
+                ret = socket->setTcpNoDelay(true);
+            }
+            if (ret == 0 && config->getSendBufferSize() > 0) {
+                ret = socket->setSendBufferSize(config->getSendBufferSize());
+            }
+            if (ret == 0 && config->getReceiveBufferSize() > 0) {
+                ret = socket->setReceiveBufferSize(config->getReceiveBufferSize());
+            }
+            if (ret == 0 && config->getSocketBusyPoll() > 0) {
+                ret = socket->setBusyPoll(config->getSocketBusyPoll());
+            }
+
+            return ret;
+        }
+
         void connectEvent() override {
             int cErrno = -1;
 
@@ -20,14 +20,19 @@
 #define CORE_SOCKET_STREAM_SOCKETREADER_H
 
 #include "core/eventreceiver/ReadEventReceiver.h"
+#include "core/socket/stream/AdaptiveBlockSize.h"
+#include "core/socket/stream/SharedReadBuffer.h"
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
 #include "log/Logger.h"
 
+#include <algorithm>
 #include <cerrno>
 #include <cstddef>
 #include <functional>
+#include <span>
+#include <sys/socket.h>
 #include <sys/types.h>
 #include <vector>
 
@@ -47,9 +52,12 @@ namespace core::socket::stream {
         explicit SocketReader(const std::function<void(int)>& onError,
                               const utils::Timeval& timeout,
                               std::size_t blockSize,
+                              bool sharedReadBuffer,
                               const utils::Timeval& terminateTimeout)
             : core::eventreceiver::ReadEventReceiver("SocketReader")
             , onError(onError)
+            , blockSize(blockSize)
+            , sharedReadBuffer(sharedReadBuffer)
             , terminateTimeout(terminateTimeout) {
             setBlockSize(blockSize);
             setTimeout(timeout);
@@ -64,19 +72,44 @@ namespace core::socket::stream {
 
     protected:
         void setBlockSize(std::size_t readBlockSize) {
-            readBuffer.resize(readBlockSize);
-            this->blockSize = readBlockSize;
+            if (!sharedReadBuffer) {
+                readBuffer.resize(readBlockSize);
+            }
+            this->blockSize.set(readBlockSize);
+        }
+
+        // The block size follows the traffic between minBlockSize and maxBlockSize but never exceeds the socket receive buffer
+        void setAdaptiveBlockSize(std::size_t minBlockSize, std::size_t maxBlockSize) {
+            int socketBufferSize = 0;
+            socklen_t socketBufferSizeLen = sizeof(socketBufferSize);
+
+            if (Socket::getSockopt(SOL_SOCKET, SO_RCVBUF, &socketBufferSize, &socketBufferSizeLen) == 0 && socketBufferSize > 0) {
+                maxBlockSize = std::min(maxBlockSize, static_cast<std::size_t>(socketBufferSize));
+            }
+
+            blockSize.setLimits(minBlockSize, maxBlockSize);
         }
 
         std::size_t readFromPeer(char* junk, std::size_t junkLen) {
-            std::size_t maxReturn = std::min(junkLen, size);
+            std::span<const char> unread = peek().first(std::min(junkLen, size));
 
-            std::copy(readBuffer.data() + cursor, readBuffer.data() + cursor + maxReturn, junk);
+            std::copy(unread.begin(), unread.end(), junk);
 
-            cursor += maxReturn;
-            size -= maxReturn;
+            return consume(unread.size());
+        }
+
+        // In-place access to the unread bytes. The view stays valid until the next read from the socket.
+        std::span<const char> peek() const {
+            return {data + cursor, size};
+        }
 
-            return maxReturn;
+        std::size_t consume(std::size_t len) {
+            len = std::min(len, size);
+
+            cursor += len;
+            size -= len;
+
+            return len;
         }
 
         std::size_t doRead() {
@@ -85,17 +118,37 @@ namespace core::socket::stream {
             if (size == 0) {
                 cursor = 0;
 
-                std::size_t readLen = blockSize - size;
-                ssize_t retRead = read(readBuffer.data() + size, readLen);
+                std::size_t readLen = blockSize.get();
+
+                char* buffer = nullptr;
+                if (sharedReadBuffer) {
+                    readBuffer = std::vector<char>(); // unconsumed bytes of the previous read have been delivered completely
+                    buffer = SharedReadBuffer::get(readLen);
+                } else {
+                    if (readBuffer.size() != readLen) {
+                        readBuffer = std::vector<char>(readLen);
+                    }
+                    buffer = readBuffer.data();
+                }
+
+                ssize_t retRead = read(buffer, readLen);
 
                 if (retRead > 0) {
-                    size += static_cast<std::size_t>(retRead);
+                    blockSize.transferred(readLen, static_cast<std::size_t>(retRead));
+
+                    data = buffer;
+                    size = static_cast<std::size_t>(retRead);
 
                     if (!isSuspended()) {
                         suspend();
                     }
                     publish();
                 } else if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) {
+                    if (!sharedReadBuffer && readBuffer.size() > blockSize.getMin()) {
+                        // Drained: a quiet connection does not keep a grown block. It is allocated again by the next read.
+                        readBuffer = std::vector<char>();
+                        data = nullptr;
+                    }
                     if (isSuspended()) {
                         resume();
                     }
@@ -110,6 +163,17 @@ namespace core::socket::stream {
             return size;
         }
 
+        // Called after the received data has been delivered. Bytes left unconsumed in the shared read buffer are copied into a buffer
+        // owned by the connection because the shared one is overwritten by the next read of any connection of this event loop.
+        void retainUnconsumed() {
+            if (sharedReadBuffer && size > 0 && data != readBuffer.data()) {
+                readBuffer.assign(data + cursor, data + cursor + size);
+
+                data = readBuffer.data();
+                cursor = 0;
+            }
+        }
+
         void shutdown() {
             if (!shutdownTriggered) {
                 Socket::shutdown(Socket::SHUT::RD);
@@ -131,8 +195,11 @@ namespace core::socket::stream {
     private:
         std::function<void(int)> onError;
 
-        std::vector<char> readBuffer;
-        std::size_t blockSize;
+        std::vector<char> readBuffer; // whole block or, in case of a shared read buffer, unconsumed bytes only
+        AdaptiveBlockSize blockSize;
+        bool sharedReadBuffer;
+
+        const char* data = nullptr;
 
         std::size_t size = 0;
         std::size_t cursor = 0;
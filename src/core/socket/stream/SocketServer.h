@@ -19,6 +19,9 @@
 #ifndef CORE_SOCKET_STREAM_SOCKETSERVERNEW_H
 #define CORE_SOCKET_STREAM_SOCKETSERVERNEW_H
 
+#include "core/SNodeC.h"
+#include "core/socket/stream/AcceptorStatistics.h" // IWYU pragma: export
+
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
 #include "log/Logger.h"
@@ -57,7 +60,9 @@ namespace core::socket::stream {
             , _onConnect(onConnect)
             , _onConnected(onConnected)
             , _onDisconnect(onDisconnect)
-            , options(options) {
+            , options(options)
+            , acceptorStatistics(std::make_shared<AcceptorStatistics>()) {
+            this->options.insert({{"ACCEPTOR_STATISTICS", acceptorStatistics}});
         }
 
         SocketServer(const std::function<void(SocketConnection*)>& onConnect,
@@ -73,6 +78,25 @@ namespace core::socket::stream {
             if (Super::config->isLocalInitialized()) {
                 SocketAcceptor* socketAcceptor = new SocketAcceptor(socketContextFactory, _onConnect, _onConnected, _onDisconnect, options);
                 socketAcceptor->listen(Super::config, onError);
+
+                // Each additional event loop gets its own acceptor bound to the same address using SO_REUSEPORT
+                core::SNodeC::addEventLoopInitializer(
+                    [config = Super::config]() -> int {
+                        return config->getEventLoops();
+                    },
+                    [config = Super::config]() -> bool {
+                        return config->getCpuAffinity();
+                    },
+                    [socketContextFactory = this->socketContextFactory,
+                     onConnect = this->_onConnect,
+                     onConnected = this->_onConnected,
+                     onDisconnect = this->_onDisconnect,
+                     options = this->options,
+                     config = Super::config,
+                     onError]() -> void {
+                        SocketAcceptor* socketAcceptor = new SocketAcceptor(socketContextFactory, onConnect, onConnected, onDisconnect, options);
+                        socketAcceptor->listen(config, onError);
+                    });
             } else {
                 LOG(ERROR) << "Parameterless listen on anonymous server instance";
             }
@@ -94,6 +118,11 @@ namespace core::socket::stream {
             return socketContextFactory;
         }
 
+        // Accepted, rejected and active connections summed over all event loops of this instance
+        const AcceptorStatistics& getAcceptorStatistics() const {
+            return *acceptorStatistics;
+        }
+
     protected:
         std::shared_ptr<SocketContextFactory> socketContextFactory;
 
@@ -102,6 +131,8 @@ namespace core::socket::stream {
         std::function<void(SocketConnection*)> _onDisconnect;
 
         std::map<std::string, std::any> options;
+
+        std::shared_ptr<AcceptorStatistics> acceptorStatistics;
     };
 
 } // namespace core::socket::stream
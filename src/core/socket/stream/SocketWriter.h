@@ -20,15 +20,23 @@
 #define CORE_SOCKET_STREAM_SOCKETWRITER_H
 
 #include "core/eventreceiver/WriteEventReceiver.h"
+#include "core/socket/stream/AdaptiveBlockSize.h"
+#include "core/socket/stream/BufferChain.h"
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
+#include "core/system/unistd.h"
 #include "log/Logger.h"
 
+#include <algorithm>
 #include <cerrno>
 #include <cstddef>
 #include <functional>
+#include <memory>
+#include <string>
+#include <sys/socket.h>
 #include <sys/types.h>
+#include <utility>
 #include <vector>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
@@ -45,11 +53,18 @@ namespace core::socket::stream {
         using Socket = SocketT;
 
         explicit SocketWriter(const std::function<void(int)>& onError,
+                              const std::function<void(bool)>& onWriteBufferFill,
                               const utils::Timeval& timeout,
                               std::size_t blockSize,
+                              std::size_t highWatermark,
+                              std::size_t lowWatermark,
                               const utils::Timeval& terminateTimeout)
             : core::eventreceiver::WriteEventReceiver("SocketWriter")
             , onError(onError)
+            , onWriteBufferFill(onWriteBufferFill)
+            , blockSize(blockSize)
+            , highWatermark(highWatermark)
+            , lowWatermark(lowWatermark)
             , terminateTimeout(terminateTimeout) {
             setBlockSize(blockSize);
             setTimeout(timeout);
@@ -58,13 +73,36 @@ namespace core::socket::stream {
         ~SocketWriter() override = default;
 
     private:
-        virtual ssize_t write(const char* junk, std::size_t junkLen) = 0;
+        // more: further queued data follows immediately, e.g. the file body after an HTTP header
+        virtual ssize_t write(const iovec* iov, int iovCount, bool more) = 0;
+
+        // Transports able to let the kernel send file content directly override both
+        virtual bool isSendFileCapable() const {
+            return false;
+        }
+
+        virtual ssize_t sendFile([[maybe_unused]] int fd, [[maybe_unused]] off_t* offset, [[maybe_unused]] std::size_t count) {
+            errno = ENOSYS;
+            return -1;
+        }
 
         void writeEvent() override = 0;
 
     protected:
         void setBlockSize(std::size_t writeBlockSize) {
-            this->blockSize = writeBlockSize;
+            this->blockSize.set(writeBlockSize);
+        }
+
+        // The block size follows the traffic between minBlockSize and maxBlockSize but never exceeds the socket send buffer
+        void setAdaptiveBlockSize(std::size_t minBlockSize, std::size_t maxBlockSize) {
+            int socketBufferSize = 0;
+            socklen_t socketBufferSizeLen = sizeof(socketBufferSize);
+
+            if (Socket::getSockopt(SOL_SOCKET, SO_SNDBUF, &socketBufferSize, &socketBufferSizeLen) == 0 && socketBufferSize > 0) {
+                maxBlockSize = std::min(maxBlockSize, static_cast<std::size_t>(socketBufferSize));
+            }
+
+            blockSize.setLimits(minBlockSize, maxBlockSize);
         }
 
         virtual void doWriteShutdown(const std::function<void(int)>& onShutdown) {
@@ -76,12 +114,30 @@ namespace core::socket::stream {
         }
 
         void sendToPeer(const char* junk, std::size_t junkLen) {
-            if (!shutdownInProgress && !markShutdown) {
-                if (writeBuffer.empty()) {
-                    resume();
-                }
+            if (prepareSend()) {
+                writeBuffer.append(junk, junkLen);
+                checkHighWatermark();
+            }
+        }
 
-                writeBuffer.insert(writeBuffer.end(), junk, junk + junkLen);
+        void sendToPeer(std::string&& data) {
+            if (prepareSend()) {
+                writeBuffer.append(std::move(data));
+                checkHighWatermark();
+            }
+        }
+
+        void sendToPeer(std::vector<char>&& data) {
+            if (prepareSend()) {
+                writeBuffer.append(std::move(data));
+                checkHighWatermark();
+            }
+        }
+
+        void sendToPeer(const std::shared_ptr<const std::string>& data) {
+            if (prepareSend()) {
+                writeBuffer.append(data);
+                checkHighWatermark();
             }
         }
 
@@ -89,28 +145,53 @@ namespace core::socket::stream {
             errno = 0;
 
             if (!writeBuffer.empty()) {
-                std::size_t writeLen = (writeBuffer.size() < blockSize) ? writeBuffer.size() : blockSize;
-                ssize_t retWrite = write(writeBuffer.data(), writeLen);
+                ssize_t retWrite = 0;
+                std::size_t writeLen = blockSize.get();
+                std::size_t requested = 0;
+
+                off_t offset = 0;
+                std::size_t count = 0;
+                int fd = writeBuffer.getFile(offset, count);
+
+                if (fd >= 0) {
+                    requested = std::min(count, writeLen);
+                    retWrite = sendFile(fd, &offset, requested);
+
+                    if (retWrite == 0) { // file has been truncated meanwhile
+                        errno = EIO;
+                    }
+                } else {
+                    iovec iov[BufferChain::MAX_IOV];
+                    int iovCount = writeBuffer.getIoVec(iov, BufferChain::MAX_IOV, writeLen);
+
+                    for (int i = 0; i < iovCount; i++) {
+                        requested += iov[i].iov_len;
+                    }
+
+                    retWrite = write(iov, iovCount, writeBuffer.size() > requested);
+                }
                 int tempErrno = errno;
+
+                if (retWrite > 0 && requested == writeLen) { // only writes limited by the block size tell about it
+                    blockSize.transferred(requested, static_cast<std::size_t>(retWrite));
+                }
                 errno = tempErrno;
 
                 if (retWrite > 0) {
-                    writeBuffer.erase(writeBuffer.begin(), writeBuffer.begin() + retWrite);
+                    writeBuffer.consume(static_cast<std::size_t>(retWrite));
+
+                    if (writeBufferFull && writeBuffer.size() <= lowWatermark) {
+                        writeBufferFull = false;
+                        onWriteBufferFill(false);
+                    }
 
                     if (!isSuspended()) {
                         suspend();
                     }
                     if (!writeBuffer.empty()) {
-                        if (writeBuffer.capacity() > writeBuffer.size() * 2) {
-                            writeBuffer.shrink_to_fit();
-                        }
                         publish();
-                    } else {
-                        writeBuffer.shrink_to_fit();
-
-                        if (markShutdown) {
-                            shutdown(onShutdown);
-                        }
+                    } else if (markShutdown) {
+                        shutdown(onShutdown);
                     }
                 } else if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) {
                     if (isSuspended()) {
@@ -125,6 +206,43 @@ namespace core::socket::stream {
             }
         }
 
+        // Takes the ownership of fd only in case true is returned
+        bool sendFileToPeer(int fd, off_t offset, std::size_t count) {
+            bool capable = isSendFileCapable();
+
+            if (capable) {
+                if (prepareSend()) {
+                    writeBuffer.appendFile(fd, offset, count);
+                    checkHighWatermark();
+                } else {
+                    core::system::close(fd);
+                }
+            }
+
+            return capable;
+        }
+
+    private:
+        bool prepareSend() {
+            bool sendable = !shutdownInProgress && !markShutdown;
+
+            if (sendable && writeBuffer.empty() && isEnabled()) {
+                // The writer stays suspended as long as writing succeeds. It is resumed only after EAGAIN
+                publish();
+            }
+
+            return sendable;
+        }
+
+        // Reported on each send while above the high watermark, thus also sources connected meanwhile get suspended
+        void checkHighWatermark() {
+            if (highWatermark > 0 && writeBuffer.size() > highWatermark) {
+                writeBufferFull = true;
+                onWriteBufferFill(true);
+            }
+        }
+
+    protected:
         void shutdown(const std::function<void(int)>& onShutdown) {
             if (!shutdownInProgress) {
                 this->onShutdown = onShutdown;
@@ -153,9 +271,13 @@ namespace core::socket::stream {
     private:
         std::function<void(int)> onError;
         std::function<void(int)> onShutdown;
+        std::function<void(bool)> onWriteBufferFill;
 
-        std::vector<char> writeBuffer;
-        std::size_t blockSize;
+        BufferChain writeBuffer;
+        AdaptiveBlockSize blockSize;
+        std::size_t highWatermark;
+        std::size_t lowWatermark;
+        bool writeBufferFull = false;
 
         bool markShutdown = false;
         bool shutdownInProgress = false;
@@ -56,7 +56,15 @@ namespace core::socket::stream::legacy {
                          const utils::Timeval& readTimeout,
                          const utils::Timeval& writeTimeout,
                          std::size_t readBlockSize,
+                         bool sharedReadBuffer,
+                         std::size_t readBudget,
+                         std::size_t readBudgetReads,
                          std::size_t writeBlockSize,
+                         bool adaptiveBlockSize,
+                         std::size_t minBlockSize,
+                         std::size_t maxBlockSize,
+                         std::size_t writeHighWatermark,
+                         std::size_t writeLowWatermark,
                          const utils::Timeval& terminateTimeout)
             : Super(
                   fd,
@@ -72,7 +80,15 @@ namespace core::socket::stream::legacy {
                   readTimeout,
                   writeTimeout,
                   readBlockSize,
+                  sharedReadBuffer,
+                  readBudget,
+                  readBudgetReads,
                   writeBlockSize,
+                  adaptiveBlockSize,
+                  minBlockSize,
+                  maxBlockSize,
+                  writeHighWatermark,
+                  writeLowWatermark,
                   terminateTimeout) {
         }
 
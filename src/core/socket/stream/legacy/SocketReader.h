@@ -33,8 +33,18 @@ namespace core::socket::stream::legacy {
     class SocketReader : public core::socket::stream::SocketReader<SocketT> {
     private:
         using Super = core::socket::stream::SocketReader<SocketT>;
-        using Super::Super;
 
+    protected:
+        explicit SocketReader(const std::function<void(int)>& onError,
+                              const utils::Timeval& timeout,
+                              std::size_t blockSize,
+                              bool sharedReadBuffer,
+                              const utils::Timeval& terminateTimeout)
+            : Super(onError, timeout, blockSize, sharedReadBuffer, terminateTimeout) {
+            this->setEdgeTriggerable(true);
+        }
+
+    private:
         ssize_t read(char* junk, std::size_t junkLen) override {
             return core::system::recv(this->getFd(), junk, junkLen, 0);
         }
@@ -23,6 +23,7 @@
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
+#include "core/system/sendfile.h"
 #include "core/system/socket.h"
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
@@ -33,10 +34,35 @@ namespace core::socket::stream::legacy {
     class SocketWriter : public core::socket::stream::SocketWriter<SocketT> {
     private:
         using Super = core::socket::stream::SocketWriter<SocketT>;
-        using Super::Super;
 
-        ssize_t write(const char* junk, std::size_t junkLen) override {
-            return core::system::send(this->getFd(), junk, junkLen, MSG_NOSIGNAL);
+    protected:
+        explicit SocketWriter(const std::function<void(int)>& onError,
+                              const std::function<void(bool)>& onWriteBufferFill,
+                              const utils::Timeval& timeout,
+                              std::size_t blockSize,
+                              std::size_t highWatermark,
+                              std::size_t lowWatermark,
+                              const utils::Timeval& terminateTimeout)
+            : Super(onError, onWriteBufferFill, timeout, blockSize, highWatermark, lowWatermark, terminateTimeout) {
+            this->setEdgeTriggerable(true);
+        }
+
+    private:
+        ssize_t write(const iovec* iov, int iovCount, bool more) override {
+            msghdr msg{};
+            msg.msg_iov = const_cast<iovec*>(iov);
+            msg.msg_iovlen = static_cast<std::size_t>(iovCount);
+
+            // MSG_MORE lets the kernel coalesce this write with the next one instead of pushing a short segment
+            return core::system::sendmsg(this->getFd(), &msg, MSG_NOSIGNAL | (more ? MSG_MORE : 0));
+        }
+
+        bool isSendFileCapable() const override {
+            return true;
+        }
+
+        ssize_t sendFile(int fd, off_t* offset, std::size_t count) override {
+            return core::system::sendfile(this->getFd(), fd, offset, count);
         }
     };
 
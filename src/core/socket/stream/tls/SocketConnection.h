@@ -60,7 +60,15 @@ namespace core::socket::stream::tls {
                          const utils::Timeval& readTimeout,
                          const utils::Timeval& writeTimeout,
                          std::size_t readBlockSize,
+                         bool sharedReadBuffer,
+                         std::size_t readBudget,
+                         std::size_t readBudgetReads,
                          std::size_t writeBlockSize,
+                         bool adaptiveBlockSize,
+                         std::size_t minBlockSize,
+                         std::size_t maxBlockSize,
+                         std::size_t writeHighWatermark,
+                         std::size_t writeLowWatermark,
                          const utils::Timeval& terminateTimeout)
             : Super(
                   fd,
@@ -76,7 +84,15 @@ namespace core::socket::stream::tls {
                   readTimeout,
                   writeTimeout,
                   readBlockSize,
+                  sharedReadBuffer,
+                  readBudget,
+                  readBudgetReads,
                   writeBlockSize,
+                  adaptiveBlockSize,
+                  minBlockSize,
+                  maxBlockSize,
+                  writeHighWatermark,
+                  writeLowWatermark,
                   terminateTimeout) {
         }
 
@@ -84,16 +100,31 @@ namespace core::socket::stream::tls {
             return ssl;
         }
 
+        // True as soon as OpenSSL has handed the record encryption over to the kernel (kTLS)
+        bool isKTlsSend() const {
+            return SocketWriter::isKTlsSend();
+        }
+
     private:
         ~SocketConnection() override = default;
 
-        SSL* startSSL(SSL_CTX* ctx, const utils::Timeval& initTimeout, const utils::Timeval& shutdownTimeout) {
+        SSL* startSSL(SSL_CTX* ctx, const utils::Timeval& initTimeout, const utils::Timeval& shutdownTimeout, bool kTls) {
             this->initTimeout = initTimeout;
             this->shutdownTimeout = shutdownTimeout;
             if (ctx != nullptr) {
                 ssl = SSL_new(ctx);
 
                 if (ssl != nullptr) {
+#ifdef SSL_OP_ENABLE_KTLS
+                    // OpenSSL falls back to userspace encryption silently if the kernel or the cipher does not support kTLS
+                    if (kTls) {
+                        SSL_set_options(ssl, SSL_OP_ENABLE_KTLS);
+                    }
+#else
+                    if (kTls) {
+                        LOG(WARNING) << "SSL/TLS kTLS not supported by OpenSSL";
+                    }
+#endif
                     if (SSL_set_fd(ssl, Socket::getFd()) == 1) {
                         SocketReader::ssl = ssl;
                         SocketWriter::ssl = ssl;
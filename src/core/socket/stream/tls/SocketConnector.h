@@ -53,15 +53,19 @@ namespace core::socket::stream::tls {
                   socketContextFactory,
                   onConnect,
                   [onConnected, this](SocketConnection* socketConnection) -> void { // onConnect
-                      SSL* ssl = socketConnection->startSSL(this->ctx, this->config->getInitTimeout(), this->config->getShutdownTimeout());
+                      SSL* ssl = socketConnection->startSSL(
+                          this->ctx, this->config->getInitTimeout(), this->config->getShutdownTimeout(), this->config->getKTls());
 
                       if (ssl != nullptr) {
                           SSL_set_connect_state(ssl);
                           ssl_set_sni(ssl, this->options);
 
                           socketConnection->doSSLHandshake(
-                              [onConnected, socketConnection](void) -> void { // onSuccess
+                              [onConnected, socketConnection, this](void) -> void { // onSuccess
                                   LOG(INFO) << "SSL/TLS initial handshake success";
+                                  if (this->config->getKTls()) {
+                                      LOG(INFO) << "SSL/TLS kTLS send " << (socketConnection->isKTlsSend() ? "active" : "not available");
+                                  }
                                   onConnected(socketConnection);
                                   socketConnection->onConnected();
                               },
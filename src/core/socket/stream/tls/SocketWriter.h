@@ -40,54 +40,104 @@ namespace core::socket::stream::tls {
         using Super = core::socket::stream::SocketWriter<SocketT>;
         using Super::Super;
 
-        ssize_t write(const char* junk, std::size_t junkLen) override {
-            int ret = SSL_write(ssl, junk, static_cast<int>(junkLen));
+        ssize_t write(const iovec* iov, int iovCount, [[maybe_unused]] bool more) override {
+            ssize_t written = 0;
 
-            if (ret <= 0) {
-                int ssl_err = SSL_get_error(ssl, ret);
+            // TLS records do not gather: each segment is written on its own until one is not written completely
+            for (int i = 0; i < iovCount; i++) {
+                std::size_t segmentWritten = 0;
+                int ret = SSL_write_ex(ssl, iov[i].iov_base, iov[i].iov_len, &segmentWritten);
+
+                if (ret > 0) {
+                    written += static_cast<ssize_t>(segmentWritten);
 
-                switch (ssl_err) {
-                    case SSL_ERROR_NONE:
+                    if (segmentWritten < iov[i].iov_len) {
                         break;
-                    case SSL_ERROR_WANT_READ: {
-                        int tmpErrno = errno;
-                        LOG(INFO) << "SSL/TLS start renegotiation on write";
-                        doSSLHandshake(
-                            [](void) -> void {
-                                LOG(INFO) << "SSL/TLS renegotiation on write success";
-                            },
-                            [](void) -> void {
-                                LOG(WARNING) << "SSL/TLS renegotiation on write timed out";
-                            },
-                            [](int ssl_err) -> void {
-                                ssl_log("SSL/TLS renegotiation", ssl_err);
-                            });
-                        errno = tmpErrno;
                     }
-                        ret = -1;
-                        break;
-                    case SSL_ERROR_WANT_WRITE:
-                        ret = -1;
-                        break;
-                    case SSL_ERROR_ZERO_RETURN: // shutdown cleanly
-                        errno = EPIPE;
-                        ret = -1; // on the write side this means a TCP broken pipe
-                        break;
-                    case SSL_ERROR_SYSCALL:
-                        ret = -1;
-                        break;
-                    default:
-                        ssl_log("SSL/TLS write failed", ssl_err);
-                        errno = EIO;
-                        ret = -1;
-                        break;
+                } else {
+                    if (written == 0) {
+                        written = writeFailed(ret);
+                    }
+                    break;
                 }
             }
 
+            return written;
+        }
+
+        // With kTLS the kernel encrypts, thus SSL_sendfile() can send file content without copying it to userspace
+        bool isSendFileCapable() const override {
+            return isKTlsSend();
+        }
+
+        ssize_t sendFile([[maybe_unused]] int fd, [[maybe_unused]] off_t* offset, [[maybe_unused]] std::size_t count) override {
+            ssize_t ret = -1;
+
+#ifdef SSL_OP_ENABLE_KTLS
+            ret = SSL_sendfile(ssl, fd, *offset, count, 0);
+
+            if (ret <= 0) {
+                ret = writeFailed(static_cast<int>(ret));
+            }
+#else
+            errno = ENOSYS;
+#endif
+
+            return ret;
+        }
+
+        ssize_t writeFailed(int ret) {
+            int ssl_err = SSL_get_error(ssl, ret);
+
+            switch (ssl_err) {
+                case SSL_ERROR_NONE:
+                    break;
+                case SSL_ERROR_WANT_READ: {
+                    int tmpErrno = errno;
+                    LOG(INFO) << "SSL/TLS start renegotiation on write";
+                    doSSLHandshake(
+                        [](void) -> void {
+                            LOG(INFO) << "SSL/TLS renegotiation on write success";
+                        },
+                        [](void) -> void {
+                            LOG(WARNING) << "SSL/TLS renegotiation on write timed out";
+                        },
+                        [](int ssl_err) -> void {
+                            ssl_log("SSL/TLS renegotiation", ssl_err);
+                        });
+                    errno = tmpErrno;
+                }
+                    ret = -1;
+                    break;
+                case SSL_ERROR_WANT_WRITE:
+                    ret = -1;
+                    break;
+                case SSL_ERROR_ZERO_RETURN: // shutdown cleanly
+                    errno = EPIPE;
+                    ret = -1; // on the write side this means a TCP broken pipe
+                    break;
+                case SSL_ERROR_SYSCALL:
+                    ret = -1;
+                    break;
+                default:
+                    ssl_log("SSL/TLS write failed", ssl_err);
+                    errno = EIO;
+                    ret = -1;
+                    break;
+            }
+
             return ret;
         }
 
     protected:
+        bool isKTlsSend() const {
+#ifdef SSL_OP_ENABLE_KTLS
+            return ssl != nullptr && BIO_get_ktls_send(SSL_get_wbio(ssl));
+#else
+            return false;
+#endif
+        }
+
         virtual void doSSLHandshake(const std::function<void()>& onSuccess,
                                     const std::function<void()>& onTimeout,
                                     const std::function<void(int)>& onError) = 0;
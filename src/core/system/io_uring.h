@@ -0,0 +1,41 @@
+/*
+ * snode.c - a slim toolkit for network communication
+ * Copyright (C) 2020, 2021, 2022 Volker Christian <me@vchrist.at>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NET_SYSTEM_IO_URING_H
+#define NET_SYSTEM_IO_URING_H
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+// IWYU pragma: begin_exports
+
+#include <cstddef>
+#include <linux/io_uring.h>
+
+// IWYU pragma: end_exports
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace core::system {
+
+    // There is no glibc wrapper for the io_uring syscalls
+    int io_uring_setup(unsigned int entries, io_uring_params* params);
+    int io_uring_enter(int fd, unsigned int toSubmit, unsigned int minComplete, unsigned int flags, const void* arg, std::size_t argsz);
+
+} // namespace core::system
+
+#endif // NET_SYSTEM_IO_URING_H
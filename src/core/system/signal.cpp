@@ -31,4 +31,14 @@ namespace core::system {
         return ::signal(signum, handler);
     }
 
+    int pthread_sigmask(int how, const sigset_t* set, sigset_t* oldset) {
+        errno = ::pthread_sigmask(how, set, oldset);
+        return errno == 0 ? 0 : -1;
+    }
+
+    int signalfd(int fd, const sigset_t* mask, int flags) {
+        errno = 0;
+        return ::signalfd(fd, mask, flags);
+    }
+
 } // namespace core::system
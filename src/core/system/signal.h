@@ -24,6 +24,7 @@
 // IWYU pragma: begin_exports
 
 #include <csignal>
+#include <sys/signalfd.h>
 
 // IWYU pragma: end_exports
 
@@ -34,6 +35,12 @@ namespace core::system {
     // #include <csignal>
     sighandler_t signal(int signum, sighandler_t handler);
 
+    // #include <csignal>
+    int pthread_sigmask(int how, const sigset_t* set, sigset_t* oldset);
+
+    // #include <sys/signalfd.h>
+    int signalfd(int fd, const sigset_t* mask, int flags);
+
 } // namespace core::system
 
 #endif // NET_SYSTEM_SIGNAL_H
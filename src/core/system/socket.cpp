@@ -70,11 +70,26 @@ namespace core::system {
         return ::recv(sockfd, buf, len, flags);
     }
 
+    ssize_t recvmsg(int sockfd, msghdr* msg, int flags) {
+        errno = 0;
+        return ::recvmsg(sockfd, msg, flags);
+    }
+
     ssize_t send(int sockfd, const void* buf, std::size_t len, int flags) {
         errno = 0;
         return ::send(sockfd, buf, len, flags);
     }
 
+    ssize_t sendto(int sockfd, const void* buf, std::size_t len, int flags, const sockaddr* dest_addr, socklen_t addrlen) {
+        errno = 0;
+        return ::sendto(sockfd, buf, len, flags, dest_addr, addrlen);
+    }
+
+    ssize_t sendmsg(int sockfd, const msghdr* msg, int flags) {
+        errno = 0;
+        return ::sendmsg(sockfd, msg, flags);
+    }
+
     int getsockopt(int sockfd, int level, int optname, void* optval, socklen_t* optlen) {
         errno = 0;
         return ::getsockopt(sockfd, level, optname, optval, optlen);
@@ -46,7 +46,10 @@ namespace core::system {
     int accept4(int sockfd, sockaddr* addr, socklen_t* addrlen, int flags);
     int connect(int sockfd, const sockaddr* addr, socklen_t addrlen);
     ssize_t recv(int sockfd, void* buf, std::size_t len, int flags);
+    ssize_t recvmsg(int sockfd, msghdr* msg, int flags);
     ssize_t send(int sockfd, const void* buf, std::size_t len, int flags);
+    ssize_t sendto(int sockfd, const void* buf, std::size_t len, int flags, const sockaddr* dest_addr, socklen_t addrlen);
+    ssize_t sendmsg(int sockfd, const msghdr* msg, int flags);
     int getsockopt(int sockfd, int level, int optname, void* optval, socklen_t* optlen);
     int setsockopt(int sockfd, int level, int optname, const void* optval, socklen_t optlen);
 
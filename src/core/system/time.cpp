@@ -36,6 +36,11 @@ namespace core::system {
         return ::gettimeofday(tv, tz);
     }
 
+    int clock_gettime(clockid_t clockid, struct timespec* tp) {
+        errno = 0;
+        return ::clock_gettime(clockid, tp);
+    }
+
     struct tm* gmtime(const time_t* timep) {
         errno = 0;
         return ::gmtime(timep);
@@ -40,6 +40,9 @@ namespace core::system {
     // #include <sys/time.h>
     int gettimeofday(struct timeval* tv, struct timezone* tz);
 
+    // #include <time.h> = <ctime>
+    int clock_gettime(clockid_t clockid, struct timespec* tp);
+
 } // namespace core::system
 
 #endif // NET_SYSTEM_TIME_H
@@ -19,6 +19,7 @@
 
 #include "database/mariadb/MariaDBConnection.h"
 
+#include "core/SNodeC.h"
 #include "database/mariadb/MariaDBClient.h"
 #include "database/mariadb/commands/async/MariaDBConnectCommand.h"
 
@@ -101,7 +102,7 @@ namespace database::mariadb {
     }
 
     void MariaDBConnection::execute_sync(MariaDBCommand* mariaDBCommand) {
-        mariaDBCommand->commandStart(mysql, utils::Timeval::currentTime());
+        mariaDBCommand->commandStart(mysql, core::SNodeC::getCurrentTime());
 
         if (mysql_errno(mysql) == 0) {
             if (mariaDBCommand->commandCompleted()) {
@@ -0,0 +1,111 @@
+/*
+ * snode.c - a slim toolkit for network communication
+ * Copyright (C) 2020, 2021, 2022 Volker Christian <me@vchrist.at>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "express/middleware/EventLoopStatistics.h"
+
+#include "core/SNodeC.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+namespace express::middleware {
+
+    static std::string toJson(const core::Histogram& histogram) {
+        std::string buckets;
+        for (std::size_t bucket = 0; bucket < core::Histogram::BUCKETS; bucket++) {
+            buckets += (bucket > 0 ? "," : "") + std::to_string(histogram.getBuckets()[bucket]);
+        }
+
+        return "{\"count\":" + std::to_string(histogram.getCount()) + ",\"mean\":" + std::to_string(histogram.getMean()) +
+               ",\"p50\":" + std::to_string(histogram.getPercentile(0.5)) + ",\"p99\":" + std::to_string(histogram.getPercentile(0.99)) +
+               ",\"max\":" + std::to_string(histogram.getMax()) + ",\"buckets\":[" + buckets + "]}";
+    }
+
+    static std::string toJson(const std::vector<core::Watchdog::Record>& records) {
+        std::string json;
+
+        for (const core::Watchdog::Record& record : records) {
+            std::string name;
+            for (char c : record.name) {
+                if (c == '"' || c == '\\') {
+                    name += '\\';
+                }
+                name += c;
+            }
+
+            json += (json.empty() ? "{\"name\":\"" : ",{\"name\":\"") + name + "\",\"durationMs\":" + std::to_string(record.duration.msd()) +
+                    ",\"tick\":" + std::to_string(record.tick) + "}";
+        }
+
+        return "[" + json + "]";
+    }
+
+    template <typename Values>
+    static std::string toJson(const Values& values) {
+        return "{\"read\":" + std::to_string(values[0]) + ",\"write\":" + std::to_string(values[1]) +
+               ",\"except\":" + std::to_string(values[2]) + "}";
+    }
+
+    EventLoopStatistics::EventLoopStatistics() {
+        core::SNodeC::setStatisticsEnabled(true);
+
+        get([] APPLICATION(req, res) {
+            core::EventLoopStatistics statistics = core::SNodeC::getStatistics();
+
+            res.set("Content-Type", "application/json");
+            res.send("{\"eventLoop\":" + std::to_string(core::SNodeC::getEventLoopIndex()) +
+                     ",\"enabled\":" + (statistics.enabled ? "true" : "false") + ",\"ticks\":" + std::to_string(statistics.ticks) +
+                     ",\"multiplexTimeUs\":" + toJson(statistics.multiplexTime) + ",\"dispatchTimeUs\":" + toJson(statistics.dispatchTime) +
+                     ",\"eventsPerTick\":" + toJson(statistics.eventsPerTick) +
+                     ",\"observedEventReceivers\":" + toJson(statistics.observedEventReceivers) +
+                     ",\"publishedEvents\":" + toJson(statistics.publishedEvents) +
+                     ",\"queuedEvents\":" + std::to_string(statistics.queuedEvents) +
+                     ",\"slowCallbacks\":" + toJson(core::SNodeC::getSlowCallbacks()) + "}");
+        });
+
+        del([] APPLICATION(req, res) {
+            core::SNodeC::resetStatistics();
+            core::SNodeC::resetSlowCallbacks();
+
+            res.sendStatus(204);
+        });
+    }
+
+    const class EventLoopStatistics& EventLoopStatistics::instance() {
+        // Keep the created statistics middleware alive
+        static std::shared_ptr<class EventLoopStatistics> eventLoopStatistics = nullptr;
+
+        if (eventLoopStatistics == nullptr) {
+            eventLoopStatistics = std::shared_ptr<EventLoopStatistics>(new EventLoopStatistics());
+        }
+
+        return *eventLoopStatistics;
+    }
+
+    // "Constructor" of EventLoopStatistics
+    const class EventLoopStatistics& EventLoopStatistics() {
+        return EventLoopStatistics::instance();
+    }
+
+} // namespace express::middleware
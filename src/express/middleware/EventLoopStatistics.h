@@ -0,0 +1,45 @@
+/*
+ * snode.c - a slim toolkit for network communication
+ * Copyright (C) 2020, 2021, 2022 Volker Christian <me@vchrist.at>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EXPRESS_MIDDLEWARE_EVENTLOOPSTATISTICS_H
+#define EXPRESS_MIDDLEWARE_EVENTLOOPSTATISTICS_H
+
+#include "express/Router.h"
+
+namespace express::middleware {
+
+    // Enables the event loop instrumentation and serves it, together with the slow callbacks recorded by the watchdog, as json:
+    // GET reports, DELETE resets the statistics of the event loop serving the request
+    class EventLoopStatistics : public Router {
+        EventLoopStatistics(const EventLoopStatistics&) = delete;
+        EventLoopStatistics& operator=(const EventLoopStatistics&) = delete;
+
+    protected:
+        EventLoopStatistics();
+
+        static const class EventLoopStatistics& instance();
+
+    private:
+        friend const class EventLoopStatistics& EventLoopStatistics();
+    };
+
+    const class EventLoopStatistics& EventLoopStatistics();
+
+} // namespace express::middleware
+
+#endif // EXPRESS_MIDDLEWARE_EVENTLOOPSTATISTICS_H
@@ -53,6 +53,10 @@ namespace net::config {
         return baseSc->add_flag(name, description);
     }
 
+    CLI::Option* ConfigBase::add_flag(const std::string& name, bool& variable, const std::string& description) {
+        return baseSc->add_flag(name, variable, description);
+    }
+
     void ConfigBase::parse(bool forceError) const {
         utils::Config::parse(forceError);
     }
@@ -48,6 +48,7 @@ namespace net::config {
         CLI::App* add_subcommand(const std::string& name, const std::string& description = "");
         CLI::Option* add_option(const std::string& name, int& variable, const std::string& description);
         CLI::Option* add_flag(const std::string& name, const std::string& description = "");
+        CLI::Option* add_flag(const std::string& name, bool& variable, const std::string& description);
 
         void parse(bool forceError = false) const;
 
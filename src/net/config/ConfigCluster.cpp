@@ -21,11 +21,23 @@
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
 #include "utils/CLI11.hpp"
-
-#include <cstddef>
+#include "utils/Cluster.h"
+#include "utils/Config.h"
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
+#ifndef DEFAULT_CLUSTERWORKERS
+#define DEFAULT_CLUSTERWORKERS 0
+#endif
+
+#ifndef DEFAULT_CLUSTERHEARTBEAT
+#define DEFAULT_CLUSTERHEARTBEAT 1
+#endif
+
+#ifndef DEFAULT_CLUSTERSOCKETDIR
+#define DEFAULT_CLUSTERSOCKETDIR utils::Config::getRunDir()
+#endif
+
 namespace net::config {
 
     ConfigCluster::ConfigCluster() {
@@ -42,11 +54,49 @@ namespace net::config {
                                std::to_string(MODE::SECONDARY) + " = SECONDARY, " + std::to_string(MODE::PROXY) + " = PROXY]");
             modeOpt->default_val(MODE::NONE);
             modeOpt->configurable(false);
+
+            workersOpt = clusterSc->add_option("--workers", workers, "Worker processes started by a PRIMARY (0: one per online cpu)");
+            workersOpt->type_name("[count]");
+            workersOpt->default_val(DEFAULT_CLUSTERWORKERS);
+
+            balanceOpt = clusterSc->add_option("--balance", balance, "Distribution of accepted connections to the workers");
+            balanceOpt->type_name("[" + std::to_string(BALANCE::ROUND_ROBIN) + " = ROUND_ROBIN, " +
+                                  std::to_string(BALANCE::LEAST_CONNECTIONS) + " = LEAST_CONNECTIONS]");
+            balanceOpt->default_val(BALANCE::ROUND_ROBIN);
+
+            heartbeatOpt = clusterSc->add_option(
+                "--heartbeat", heartbeat, "Load report interval of the workers. Workers missing three reports are not served");
+            heartbeatOpt->type_name("[sec]");
+            heartbeatOpt->default_val(DEFAULT_CLUSTERHEARTBEAT);
+
+            socketDirOpt = clusterSc->add_option("--socket-dir", socketDir, "Directory of the control sockets of listeners and workers");
+            socketDirOpt->type_name("[path]");
+            socketDirOpt->default_val(DEFAULT_CLUSTERSOCKETDIR);
+        } else {
+            workers = DEFAULT_CLUSTERWORKERS;
+            heartbeat = DEFAULT_CLUSTERHEARTBEAT;
+            socketDir = DEFAULT_CLUSTERSOCKETDIR;
         }
     }
 
     int ConfigCluster::getClusterMode() const {
-        return mode;
+        return mode == MODE::PRIMARY && utils::Cluster::isWorker() ? MODE::SECONDARY : mode;
+    }
+
+    std::size_t ConfigCluster::getClusterWorkers() const {
+        return workers;
+    }
+
+    int ConfigCluster::getClusterBalance() const {
+        return balance;
+    }
+
+    utils::Timeval ConfigCluster::getClusterHeartbeat() const {
+        return heartbeat;
+    }
+
+    std::string ConfigCluster::getClusterSocketDir() const {
+        return socketDir;
     }
 
 } // namespace net::config
@@ -28,6 +28,11 @@ namespace CLI {
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
+#include "utils/Timeval.h"
+
+#include <cstddef>
+#include <string>
+
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
 namespace net::config {
@@ -37,14 +42,29 @@ namespace net::config {
         ConfigCluster();
 
         enum MODE { NONE, PRIMARY, SECONDARY, PROXY };
+        enum BALANCE { ROUND_ROBIN, LEAST_CONNECTIONS };
 
+        // In a worker started by a PRIMARY the clustered instances are SECONDARY
         int getClusterMode() const;
 
+        std::size_t getClusterWorkers() const;
+        int getClusterBalance() const;
+        utils::Timeval getClusterHeartbeat() const;
+        std::string getClusterSocketDir() const;
+
     private:
         CLI::App* clusterSc = nullptr;
         CLI::Option* modeOpt = nullptr;
+        CLI::Option* workersOpt = nullptr;
+        CLI::Option* balanceOpt = nullptr;
+        CLI::Option* heartbeatOpt = nullptr;
+        CLI::Option* socketDirOpt = nullptr;
 
         MODE mode = MODE::NONE;
+        std::size_t workers = 0;
+        BALANCE balance = BALANCE::ROUND_ROBIN;
+        utils::Timeval heartbeat;
+        std::string socketDir;
     };
 
 } // namespace net::config
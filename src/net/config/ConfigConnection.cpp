@@ -36,10 +36,58 @@
 #define DEFAULT_READBLOCKSIZE 16384
 #endif
 
+#ifndef DEFAULT_SHAREDREADBUFFER
+#define DEFAULT_SHAREDREADBUFFER false
+#endif
+
 #ifndef DEFAULT_WRITEBLOCKSIZE
 #define DEFAULT_WRITEBLOCKSIZE 16384
 #endif
 
+#ifndef DEFAULT_ADAPTIVEBLOCKSIZE
+#define DEFAULT_ADAPTIVEBLOCKSIZE false
+#endif
+
+#ifndef DEFAULT_MINBLOCKSIZE
+#define DEFAULT_MINBLOCKSIZE 4096
+#endif
+
+#ifndef DEFAULT_MAXBLOCKSIZE
+#define DEFAULT_MAXBLOCKSIZE 262144
+#endif
+
+#ifndef DEFAULT_READBUDGET
+#define DEFAULT_READBUDGET 0
+#endif
+
+#ifndef DEFAULT_READBUDGETREADS
+#define DEFAULT_READBUDGETREADS 1
+#endif
+
+#ifndef DEFAULT_WRITEHIGHWATERMARK
+#define DEFAULT_WRITEHIGHWATERMARK 1048576
+#endif
+
+#ifndef DEFAULT_WRITELOWWATERMARK
+#define DEFAULT_WRITELOWWATERMARK 262144
+#endif
+
+#ifndef DEFAULT_TCPNODELAY
+#define DEFAULT_TCPNODELAY false
+#endif
+
+#ifndef DEFAULT_SENDBUFFERSIZE
+#define DEFAULT_SENDBUFFERSIZE 0
+#endif
+
+#ifndef DEFAULT_RECEIVEBUFFERSIZE
+#define DEFAULT_RECEIVEBUFFERSIZE 0
+#endif
+
+#ifndef DEFAULT_SOCKETBUSYPOLL
+#define DEFAULT_SOCKETBUSYPOLL 0
+#endif
+
 #ifndef DEFAULT_TERMINATETIMEOUT
 #define DEFAULT_TERMINATETIMEOUT 1
 #endif
@@ -63,10 +111,59 @@ namespace net::config {
             readBlockSizeOpt->type_name("[bytes]");
             readBlockSizeOpt->default_val(DEFAULT_READBLOCKSIZE);
 
+            sharedReadBufferOpt = connectionSc->add_flag(
+                "--shared-read-buffer", sharedReadBuffer, "Read into one buffer per event loop, keep only unconsumed bytes");
+            sharedReadBufferOpt->default_val(DEFAULT_SHAREDREADBUFFER);
+
             writeBlockSizeOpt = connectionSc->add_option("--write-block-size", writeBlockSize, "Write block size");
             writeBlockSizeOpt->type_name("[bytes]");
             writeBlockSizeOpt->default_val(DEFAULT_WRITEBLOCKSIZE);
 
+            adaptiveBlockSizeOpt = connectionSc->add_flag(
+                "--adaptive-block-size", adaptiveBlockSize, "Grow block sizes on bulk transfers and shrink them on sparse traffic");
+            adaptiveBlockSizeOpt->default_val(DEFAULT_ADAPTIVEBLOCKSIZE);
+
+            minBlockSizeOpt = connectionSc->add_option("--min-block-size", minBlockSize, "Lower bound of adaptive block sizes");
+            minBlockSizeOpt->type_name("[bytes]");
+            minBlockSizeOpt->default_val(DEFAULT_MINBLOCKSIZE);
+
+            maxBlockSizeOpt = connectionSc->add_option(
+                "--max-block-size", maxBlockSize, "Upper bound of adaptive block sizes (capped by the socket buffers)");
+            maxBlockSizeOpt->type_name("[bytes]");
+            maxBlockSizeOpt->default_val(DEFAULT_MAXBLOCKSIZE);
+
+            readBudgetOpt = connectionSc->add_option("--read-budget", readBudget, "Bytes delivered per connection and tick (0: unlimited)");
+            readBudgetOpt->type_name("[bytes]");
+            readBudgetOpt->default_val(DEFAULT_READBUDGET);
+
+            readBudgetReadsOpt = connectionSc->add_option("--read-budget-reads", readBudgetReads, "Reads per connection and tick");
+            readBudgetReadsOpt->type_name("[count]");
+            readBudgetReadsOpt->default_val(DEFAULT_READBUDGETREADS);
+
+            writeHighWatermarkOpt = connectionSc->add_option(
+                "--write-high-watermark", writeHighWatermark, "Queued bytes above which connected sources are suspended (0: unlimited)");
+            writeHighWatermarkOpt->type_name("[bytes]");
+            writeHighWatermarkOpt->default_val(DEFAULT_WRITEHIGHWATERMARK);
+
+            writeLowWatermarkOpt = connectionSc->add_option(
+                "--write-low-watermark", writeLowWatermark, "Queued bytes below which suspended sources are resumed");
+            writeLowWatermarkOpt->type_name("[bytes]");
+            writeLowWatermarkOpt->default_val(DEFAULT_WRITELOWWATERMARK);
+
+            sendBufferSizeOpt = connectionSc->add_option("--so-sndbuf", sendBufferSize, "Socket send buffer size (0: system default)");
+            sendBufferSizeOpt->type_name("[bytes]");
+            sendBufferSizeOpt->default_val(DEFAULT_SENDBUFFERSIZE);
+
+            receiveBufferSizeOpt =
+                connectionSc->add_option("--so-rcvbuf", receiveBufferSize, "Socket receive buffer size (0: system default)");
+            receiveBufferSizeOpt->type_name("[bytes]");
+            receiveBufferSizeOpt->default_val(DEFAULT_RECEIVEBUFFERSIZE);
+
+            socketBusyPollOpt =
+                connectionSc->add_option("--so-busy-poll", socketBusyPoll, "Busy poll the device queue on blocking reads (SO_BUSY_POLL)");
+            socketBusyPollOpt->type_name("[us]");
+            socketBusyPollOpt->default_val(DEFAULT_SOCKETBUSYPOLL);
+
             terminateTimeoutOpt = connectionSc->add_option("--terminate-timeout", terminateTimeout, "Terminate timeout");
             terminateTimeoutOpt->type_name("[sec]");
             terminateTimeoutOpt->default_val(DEFAULT_TERMINATETIMEOUT);
@@ -74,11 +171,30 @@ namespace net::config {
             readTimeout = DEFAULT_READTIMEOUT;
             writeTimeout = DEFAULT_WRITETIMEOUT;
             readBlockSize = DEFAULT_READBLOCKSIZE;
+            sharedReadBuffer = DEFAULT_SHAREDREADBUFFER;
             writeBlockSize = DEFAULT_WRITEBLOCKSIZE;
+            adaptiveBlockSize = DEFAULT_ADAPTIVEBLOCKSIZE;
+            minBlockSize = DEFAULT_MINBLOCKSIZE;
+            maxBlockSize = DEFAULT_MAXBLOCKSIZE;
+            readBudget = DEFAULT_READBUDGET;
+            readBudgetReads = DEFAULT_READBUDGETREADS;
+            writeHighWatermark = DEFAULT_WRITEHIGHWATERMARK;
+            writeLowWatermark = DEFAULT_WRITELOWWATERMARK;
+            tcpNoDelay = DEFAULT_TCPNODELAY;
+            sendBufferSize = DEFAULT_SENDBUFFERSIZE;
+            receiveBufferSize = DEFAULT_RECEIVEBUFFERSIZE;
+            socketBusyPoll = DEFAULT_SOCKETBUSYPOLL;
             terminateTimeout = DEFAULT_TERMINATETIMEOUT;
         }
     }
 
+    void ConfigConnection::tcpOptions() {
+        if (!getName().empty()) {
+            tcpNoDelayOpt = connectionSc->add_flag("--tcp-nodelay", tcpNoDelay, "Disable Nagle's algorithm (TCP_NODELAY)");
+            tcpNoDelayOpt->default_val(DEFAULT_TCPNODELAY);
+        }
+    }
+
     utils::Timeval ConfigConnection::getReadTimeout() const {
         utils::Timeval readTimeout = this->readTimeout;
 
@@ -109,6 +225,16 @@ namespace net::config {
         return readBlockSize;
     }
 
+    bool ConfigConnection::getSharedReadBuffer() const {
+        bool sharedReadBuffer = this->sharedReadBuffer;
+
+        if (sharedReadBufferSet >= 0 && (sharedReadBufferOpt == nullptr || sharedReadBufferOpt->count() == 0)) {
+            sharedReadBuffer = sharedReadBufferSet == 1;
+        }
+
+        return sharedReadBuffer;
+    }
+
     std::size_t ConfigConnection::getWriteBlockSize() const {
         std::size_t writeBlockSize = this->writeBlockSize;
 
@@ -119,6 +245,116 @@ namespace net::config {
         return writeBlockSize;
     }
 
+    bool ConfigConnection::getAdaptiveBlockSize() const {
+        bool adaptiveBlockSize = this->adaptiveBlockSize;
+
+        if (adaptiveBlockSizeSet >= 0 && (adaptiveBlockSizeOpt == nullptr || adaptiveBlockSizeOpt->count() == 0)) {
+            adaptiveBlockSize = adaptiveBlockSizeSet == 1;
+        }
+
+        return adaptiveBlockSize;
+    }
+
+    std::size_t ConfigConnection::getMinBlockSize() const {
+        std::size_t minBlockSize = this->minBlockSize;
+
+        if (minBlockSizeSet > 0 && (minBlockSizeOpt == nullptr || minBlockSizeOpt->count() == 0)) {
+            minBlockSize = minBlockSizeSet;
+        }
+
+        return minBlockSize;
+    }
+
+    std::size_t ConfigConnection::getMaxBlockSize() const {
+        std::size_t maxBlockSize = this->maxBlockSize;
+
+        if (maxBlockSizeSet > 0 && (maxBlockSizeOpt == nullptr || maxBlockSizeOpt->count() == 0)) {
+            maxBlockSize = maxBlockSizeSet;
+        }
+
+        return maxBlockSize;
+    }
+
+    std::size_t ConfigConnection::getReadBudget() const {
+        std::size_t readBudget = this->readBudget;
+
+        if (readBudgetSet > 0 && (readBudgetOpt == nullptr || readBudgetOpt->count() == 0)) {
+            readBudget = readBudgetSet;
+        }
+
+        return readBudget;
+    }
+
+    std::size_t ConfigConnection::getReadBudgetReads() const {
+        std::size_t readBudgetReads = this->readBudgetReads;
+
+        if (readBudgetReadsSet > 0 && (readBudgetReadsOpt == nullptr || readBudgetReadsOpt->count() == 0)) {
+            readBudgetReads = readBudgetReadsSet;
+        }
+
+        return readBudgetReads;
+    }
+
+    std::size_t ConfigConnection::getWriteHighWatermark() const {
+        std::size_t writeHighWatermark = this->writeHighWatermark;
+
+        if (writeHighWatermarkSet >= 0 && (writeHighWatermarkOpt == nullptr || writeHighWatermarkOpt->count() == 0)) {
+            writeHighWatermark = static_cast<std::size_t>(writeHighWatermarkSet);
+        }
+
+        return writeHighWatermark;
+    }
+
+    std::size_t ConfigConnection::getWriteLowWatermark() const {
+        std::size_t writeLowWatermark = this->writeLowWatermark;
+
+        if (writeLowWatermarkSet >= 0 && (writeLowWatermarkOpt == nullptr || writeLowWatermarkOpt->count() == 0)) {
+            writeLowWatermark = static_cast<std::size_t>(writeLowWatermarkSet);
+        }
+
+        return writeLowWatermark;
+    }
+
+    bool ConfigConnection::getTcpNoDelay() const {
+        bool tcpNoDelay = this->tcpNoDelay;
+
+        if (tcpNoDelaySet >= 0 && (tcpNoDelayOpt == nullptr || tcpNoDelayOpt->count() == 0)) {
+            tcpNoDelay = tcpNoDelaySet == 1;
+        }
+
+        return tcpNoDelay;
+    }
+
+    int ConfigConnection::getSendBufferSize() const {
+        int sendBufferSize = this->sendBufferSize;
+
+        if (sendBufferSizeSet >= 0 && (sendBufferSizeOpt == nullptr || sendBufferSizeOpt->count() == 0)) {
+            sendBufferSize = sendBufferSizeSet;
+        }
+
+        return sendBufferSize;
+    }
+
+    int ConfigConnection::getReceiveBufferSize() const {
+        int receiveBufferSize = this->receiveBufferSize;
+
+        if (receiveBufferSizeSet >= 0 && (receiveBufferSizeOpt == nullptr || receiveBufferSizeOpt->count() == 0)) {
+            receiveBufferSize = receiveBufferSizeSet;
+        }
+
+        return receiveBufferSize;
+    }
+
+    int ConfigConnection::getSocketBusyPoll() const {
+        int socketBusyPoll = this->socketBusyPoll;
+
+        if (socketBusyPollSet >= 0 && (socketBusyPollOpt == nullptr || socketBusyPollOpt->count() == 0)) {
+            socketBusyPoll = socketBusyPollSet;
+        }
+
+        return socketBusyPoll;
+    }
+
     utils::Timeval ConfigConnection::getTerminateTimeout() const {
         utils::Timeval terminateTimeout = this->terminateTimeout;
 
@@ -141,10 +377,58 @@ namespace net::config {
         readBlockSizeSet = newReadBlockSizeSet;
     }
 
+    void ConfigConnection::setSharedReadBuffer(bool newSharedReadBufferSet) {
+        sharedReadBufferSet = newSharedReadBufferSet ? 1 : 0;
+    }
+
     void ConfigConnection::setWriteBlockSize(std::size_t newWriteBlockSizeSet) {
         writeBlockSizeSet = newWriteBlockSizeSet;
     }
 
+    void ConfigConnection::setAdaptiveBlockSize(bool newAdaptiveBlockSizeSet) {
+        adaptiveBlockSizeSet = newAdaptiveBlockSizeSet ? 1 : 0;
+    }
+
+    void ConfigConnection::setMinBlockSize(std::size_t newMinBlockSizeSet) {
+        minBlockSizeSet = newMinBlockSizeSet;
+    }
+
+    void ConfigConnection::setMaxBlockSize(std::size_t newMaxBlockSizeSet) {
+        maxBlockSizeSet = newMaxBlockSizeSet;
+    }
+
+    void ConfigConnection::setReadBudget(std::size_t newReadBudgetSet) {
+        readBudgetSet = newReadBudgetSet;
+    }
+
+    void ConfigConnection::setReadBudgetReads(std::size_t newReadBudgetReadsSet) {
+        readBudgetReadsSet = newReadBudgetReadsSet;
+    }
+
+    void ConfigConnection::setWriteHighWatermark(std::size_t newWriteHighWatermarkSet) {
+        writeHighWatermarkSet = static_cast<ssize_t>(newWriteHighWatermarkSet);
+    }
+
+    void ConfigConnection::setWriteLowWatermark(std::size_t newWriteLowWatermarkSet) {
+        writeLowWatermarkSet = static_cast<ssize_t>(newWriteLowWatermarkSet);
+    }
+
+    void ConfigConnection::setTcpNoDelay(bool newTcpNoDelaySet) {
+        tcpNoDelaySet = newTcpNoDelaySet ? 1 : 0;
+    }
+
+    void ConfigConnection::setSendBufferSize(int newSendBufferSizeSet) {
+        sendBufferSizeSet = newSendBufferSizeSet;
+    }
+
+    void ConfigConnection::setReceiveBufferSize(int newReceiveBufferSizeSet) {
+        receiveBufferSizeSet = newReceiveBufferSizeSet;
+    }
+
+    void ConfigConnection::setSocketBusyPoll(int newSocketBusyPollSet) {
+        socketBusyPollSet = newSocketBusyPollSet;
+    }
+
     void ConfigConnection::setTerminateTimeout(const utils::Timeval& newTerminateTimeoutSet) {
         terminateTimeoutSet = newTerminateTimeoutSet;
     }
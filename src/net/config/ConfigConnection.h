@@ -30,6 +30,9 @@ namespace CLI {
 
 #include "utils/Timeval.h"
 
+#include <cstddef>
+#include <sys/types.h>
+
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
 namespace net::config {
@@ -43,26 +46,77 @@ namespace net::config {
         utils::Timeval getWriteTimeout() const;
 
         std::size_t getReadBlockSize() const;
+        bool getSharedReadBuffer() const;
         std::size_t getWriteBlockSize() const;
 
+        bool getAdaptiveBlockSize() const;
+        std::size_t getMinBlockSize() const;
+        std::size_t getMaxBlockSize() const;
+
+        std::size_t getReadBudget() const;
+        std::size_t getReadBudgetReads() const;
+
+        std::size_t getWriteHighWatermark() const;
+        std::size_t getWriteLowWatermark() const;
+
+        bool getTcpNoDelay() const;
+        int getSendBufferSize() const;
+        int getReceiveBufferSize() const;
+        int getSocketBusyPoll() const;
+
         utils::Timeval getTerminateTimeout() const;
 
         void setReadTimeout(const utils::Timeval& newReadTimeoutSet);
         void setWriteTimeout(const utils::Timeval& newWriteTimeoutSet);
 
         void setReadBlockSize(std::size_t newReadBlockSizeSet);
+        void setSharedReadBuffer(bool newSharedReadBufferSet);
         void setWriteBlockSize(std::size_t newWriteBlockSizeSet);
 
+        void setAdaptiveBlockSize(bool newAdaptiveBlockSizeSet);
+        void setMinBlockSize(std::size_t newMinBlockSizeSet);
+        void setMaxBlockSize(std::size_t newMaxBlockSizeSet);
+
+        void setReadBudget(std::size_t newReadBudgetSet);
+        void setReadBudgetReads(std::size_t newReadBudgetReadsSet);
+
+        void setWriteHighWatermark(std::size_t newWriteHighWatermarkSet);
+        void setWriteLowWatermark(std::size_t newWriteLowWatermarkSet);
+
+        void setTcpNoDelay(bool newTcpNoDelaySet);
+        void setSendBufferSize(int newSendBufferSizeSet);
+        void setReceiveBufferSize(int newReceiveBufferSizeSet);
+        void setSocketBusyPoll(int newSocketBusyPollSet);
+
         void setTerminateTimeout(const utils::Timeval& newTerminateTimeoutSet);
 
+    protected:
+        void tcpOptions();
+
     private:
         CLI::App* connectionSc = nullptr;
         CLI::Option* readTimeoutOpt = nullptr;
         CLI::Option* writeTimeoutOpt = nullptr;
 
         CLI::Option* readBlockSizeOpt = nullptr;
+        CLI::Option* sharedReadBufferOpt = nullptr;
         CLI::Option* writeBlockSizeOpt = nullptr;
 
+        CLI::Option* adaptiveBlockSizeOpt = nullptr;
+        CLI::Option* minBlockSizeOpt = nullptr;
+        CLI::Option* maxBlockSizeOpt = nullptr;
+
+        CLI::Option* readBudgetOpt = nullptr;
+        CLI::Option* readBudgetReadsOpt = nullptr;
+
+        CLI::Option* writeHighWatermarkOpt = nullptr;
+        CLI::Option* writeLowWatermarkOpt = nullptr;
+
+        CLI::Option* tcpNoDelayOpt = nullptr;
+        CLI::Option* sendBufferSizeOpt = nullptr;
+        CLI::Option* receiveBufferSizeOpt = nullptr;
+        CLI::Option* socketBusyPollOpt = nullptr;
+
         CLI::Option* terminateTimeoutOpt = nullptr;
 
         utils::Timeval readTimeout;
@@ -74,9 +128,45 @@ namespace net::config {
         std::size_t readBlockSize;
         std::size_t readBlockSizeSet = 0;
 
+        bool sharedReadBuffer;
+        int sharedReadBufferSet = -1;
+
         std::size_t writeBlockSize;
         std::size_t writeBlockSizeSet = 0;
 
+        bool adaptiveBlockSize;
+        int adaptiveBlockSizeSet = -1;
+
+        std::size_t minBlockSize;
+        std::size_t minBlockSizeSet = 0;
+
+        std::size_t maxBlockSize;
+        std::size_t maxBlockSizeSet = 0;
+
+        std::size_t readBudget;
+        std::size_t readBudgetSet = 0;
+
+        std::size_t readBudgetReads;
+        std::size_t readBudgetReadsSet = 0;
+
+        std::size_t writeHighWatermark;
+        ssize_t writeHighWatermarkSet = -1;
+
+        std::size_t writeLowWatermark;
+        ssize_t writeLowWatermarkSet = -1;
+
+        bool tcpNoDelay = false;
+        int tcpNoDelaySet = -1;
+
+        int sendBufferSize;
+        int sendBufferSizeSet = -1;
+
+        int receiveBufferSize;
+        int receiveBufferSizeSet = -1;
+
+        int socketBusyPoll;
+        int socketBusyPollSet = -1;
+
         utils::Timeval terminateTimeout;
         utils::Timeval terminateTimeoutSet = -1;
     };
@@ -32,6 +32,26 @@
 #define DEFAULT_BACKLOG 5
 #endif
 
+#ifndef DEFAULT_EVENTLOOPS
+#define DEFAULT_EVENTLOOPS 1
+#endif
+
+#ifndef DEFAULT_CPUAFFINITY
+#define DEFAULT_CPUAFFINITY false
+#endif
+
+#ifndef DEFAULT_MAXCONNECTIONS
+#define DEFAULT_MAXCONNECTIONS 0
+#endif
+
+#ifndef DEFAULT_TCPFASTOPEN
+#define DEFAULT_TCPFASTOPEN 0
+#endif
+
+#ifndef DEFAULT_TCPDEFERACCEPT
+#define DEFAULT_TCPDEFERACCEPT 0
+#endif
+
 namespace net::config {
 
     ConfigListen::ConfigListen() {
@@ -43,16 +63,46 @@ namespace net::config {
             acceptsPerTickOpt = add_option("--accepts-per-tick", acceptsPerTick, "Accepts per tick");
             acceptsPerTickOpt->type_name("[count]");
             acceptsPerTickOpt->default_val(DEFAULT_ACCEPTSPERTICK);
+
+            eventLoopsOpt = add_option("--event-loops", eventLoops, "Event loops (threads) accepting on SO_REUSEPORT sockets");
+            eventLoopsOpt->type_name("[count]");
+            eventLoopsOpt->default_val(DEFAULT_EVENTLOOPS);
+
+            cpuAffinityOpt = add_flag("--cpu-affinity", cpuAffinity, "Pin each event loop thread to its own CPU");
+            cpuAffinityOpt->default_val(DEFAULT_CPUAFFINITY);
+
+            maxConnectionsOpt = add_option(
+                "--max-connections", maxConnections, "Connections per event loop above which accepting is paused (0: unlimited)");
+            maxConnectionsOpt->type_name("[count]");
+            maxConnectionsOpt->default_val(DEFAULT_MAXCONNECTIONS);
         } else {
             backlog = DEFAULT_BACKLOG;
             acceptsPerTick = DEFAULT_ACCEPTSPERTICK;
+            eventLoops = DEFAULT_EVENTLOOPS;
+            cpuAffinity = DEFAULT_CPUAFFINITY;
+            maxConnections = DEFAULT_MAXCONNECTIONS;
+            tcpFastOpen = DEFAULT_TCPFASTOPEN;
+            tcpDeferAccept = DEFAULT_TCPDEFERACCEPT;
+        }
+    }
+
+    void ConfigListen::tcpOptions() {
+        if (!getName().empty()) {
+            tcpFastOpenOpt = add_option("--tcp-fastopen", tcpFastOpen, "Queue length of pending TCP fast open requests (0: disabled)");
+            tcpFastOpenOpt->type_name("[qlen]");
+            tcpFastOpenOpt->default_val(DEFAULT_TCPFASTOPEN);
+
+            tcpDeferAcceptOpt =
+                add_option("--tcp-defer-accept", tcpDeferAccept, "Accept connections only after data arrived (0: disabled)");
+            tcpDeferAcceptOpt->type_name("[sec]");
+            tcpDeferAcceptOpt->default_val(DEFAULT_TCPDEFERACCEPT);
         }
     }
 
     int ConfigListen::getBacklog() const {
         int backlog = this->backlog;
 
-        if (backlogSet >= 0 && backlogOpt != nullptr && backlogOpt->count() == 0) {
+        if (backlogSet >= 0 && (backlogOpt == nullptr || backlogOpt->count() == 0)) {
             backlog = this->backlogSet;
         }
 
@@ -66,7 +116,7 @@ namespace net::config {
     int ConfigListen::getAcceptsPerTick() const {
         int acceptsPerTick = this->acceptsPerTick;
 
-        if (acceptsPerTickSet > 0 && acceptsPerTickOpt != nullptr && acceptsPerTickOpt->count() == 0) {
+        if (acceptsPerTickSet > 0 && (acceptsPerTickOpt == nullptr || acceptsPerTickOpt->count() == 0)) {
             acceptsPerTick = this->acceptsPerTickSet;
         }
 
@@ -77,4 +127,74 @@ namespace net::config {
         acceptsPerTickSet = newAcceptsPerTick;
     }
 
+    int ConfigListen::getEventLoops() const {
+        int eventLoops = this->eventLoops;
+
+        if (eventLoopsSet > 0 && (eventLoopsOpt == nullptr || eventLoopsOpt->count() == 0)) {
+            eventLoops = this->eventLoopsSet;
+        }
+
+        return eventLoops;
+    }
+
+    void ConfigListen::setEventLoops(int eventLoops) {
+        eventLoopsSet = eventLoops;
+    }
+
+    bool ConfigListen::getCpuAffinity() const {
+        bool cpuAffinity = this->cpuAffinity;
+
+        if (cpuAffinitySet >= 0 && (cpuAffinityOpt == nullptr || cpuAffinityOpt->count() == 0)) {
+            cpuAffinity = this->cpuAffinitySet == 1;
+        }
+
+        return cpuAffinity;
+    }
+
+    void ConfigListen::setCpuAffinity(bool cpuAffinity) {
+        cpuAffinitySet = cpuAffinity ? 1 : 0;
+    }
+
+    int ConfigListen::getMaxConnections() const {
+        int maxConnections = this->maxConnections;
+
+        if (maxConnectionsSet >= 0 && (maxConnectionsOpt == nullptr || maxConnectionsOpt->count() == 0)) {
+            maxConnections = this->maxConnectionsSet;
+        }
+
+        return maxConnections;
+    }
+
+    void ConfigListen::setMaxConnections(int maxConnections) {
+        maxConnectionsSet = maxConnections;
+    }
+
+    int ConfigListen::getTcpFastOpen() const {
+        int tcpFastOpen = this->tcpFastOpen;
+
+        if (tcpFastOpenSet >= 0 && (tcpFastOpenOpt == nullptr || tcpFastOpenOpt->count() == 0)) {
+            tcpFastOpen = this->tcpFastOpenSet;
+        }
+
+        return tcpFastOpen;
+    }
+
+    void ConfigListen::setTcpFastOpen(int tcpFastOpen) {
+        tcpFastOpenSet = tcpFastOpen;
+    }
+
+    int ConfigListen::getTcpDeferAccept() const {
+        int tcpDeferAccept = this->tcpDeferAccept;
+
+        if (tcpDeferAcceptSet >= 0 && (tcpDeferAcceptOpt == nullptr || tcpDeferAcceptOpt->count() == 0)) {
+            tcpDeferAccept = this->tcpDeferAcceptSet;
+        }
+
+        return tcpDeferAccept;
+    }
+
+    void ConfigListen::setTcpDeferAccept(int tcpDeferAccept) {
+        tcpDeferAcceptSet = tcpDeferAccept;
+    }
+
 } // namespace net::config
@@ -41,15 +41,53 @@ namespace net::config {
         int getAcceptsPerTick() const;
         void setAcceptsPerTick(int newAcceptsPerTickSet);
 
+        int getEventLoops() const;
+        void setEventLoops(int eventLoops);
+
+        bool getCpuAffinity() const;
+        void setCpuAffinity(bool cpuAffinity);
+
+        int getMaxConnections() const;
+        void setMaxConnections(int maxConnections);
+
+        int getTcpFastOpen() const;
+        void setTcpFastOpen(int tcpFastOpen);
+
+        int getTcpDeferAccept() const;
+        void setTcpDeferAccept(int tcpDeferAccept);
+
+    protected:
+        void tcpOptions();
+
     private:
         CLI::Option* backlogOpt = nullptr;
         CLI::Option* acceptsPerTickOpt = nullptr;
+        CLI::Option* eventLoopsOpt = nullptr;
+        CLI::Option* cpuAffinityOpt = nullptr;
+        CLI::Option* maxConnectionsOpt = nullptr;
+        CLI::Option* tcpFastOpenOpt = nullptr;
+        CLI::Option* tcpDeferAcceptOpt = nullptr;
 
         int backlog = 0;
         int backlogSet = -1;
 
         int acceptsPerTick = 1;
         int acceptsPerTickSet = 0;
+
+        int eventLoops = 1;
+        int eventLoopsSet = 0;
+
+        bool cpuAffinity = false;
+        int cpuAffinitySet = -1;
+
+        int maxConnections = 0;
+        int maxConnectionsSet = -1;
+
+        int tcpFastOpen = 0;
+        int tcpFastOpenSet = -1;
+
+        int tcpDeferAccept = 0;
+        int tcpDeferAcceptSet = -1;
     };
 
 } // namespace net::config
@@ -32,6 +32,10 @@
 #define DEFAULT_SHUTDOWNTIMEOUT 2
 #endif
 
+#ifndef DEFAULT_KTLS
+#define DEFAULT_KTLS false
+#endif
+
 namespace net::config {
 
     ConfigTls::ConfigTls() {
@@ -46,9 +50,13 @@ namespace net::config {
             shutdownTimeoutOpt = tlsSc->add_option("--shutdown-timeout", shutdownTimeout, "SSL/TLS shutdown timeout");
             shutdownTimeoutOpt->type_name("[sec]");
             shutdownTimeoutOpt->default_val(DEFAULT_SHUTDOWNTIMEOUT);
+
+            kTlsOpt = tlsSc->add_flag("--ktls", kTls, "Offload record encryption to the kernel (kTLS) if supported");
+            kTlsOpt->default_val(DEFAULT_KTLS);
         } else {
             initTimeout = DEFAULT_INITTIMEOUT;
             shutdownTimeout = DEFAULT_SHUTDOWNTIMEOUT;
+            kTls = DEFAULT_KTLS;
         }
     }
 
@@ -72,6 +80,16 @@ namespace net::config {
         return shutdownTimeout;
     }
 
+    bool ConfigTls::getKTls() const {
+        bool kTls = this->kTls;
+
+        if (kTlsSet >= 0 && (kTlsOpt == nullptr || kTlsOpt->count() == 0)) {
+            kTls = this->kTlsSet == 1;
+        }
+
+        return kTls;
+    }
+
     void ConfigTls::setInitTimeout(const utils::Timeval& newInitTimeoutSet) {
         initTimeoutSet = newInitTimeoutSet;
     }
@@ -80,4 +98,8 @@ namespace net::config {
         shutdownTimeoutSet = newShutdownTimeoutSet;
     }
 
+    void ConfigTls::setKTls(bool kTls) {
+        kTlsSet = kTls ? 1 : 0;
+    }
+
 } // namespace net::config
@@ -40,20 +40,26 @@ namespace net::config {
 
         utils::Timeval getInitTimeout() const;
         utils::Timeval getShutdownTimeout() const;
+        bool getKTls() const;
 
         void setInitTimeout(const utils::Timeval& newInitTimeoutSet);
         void setShutdownTimeout(const utils::Timeval& newShutdownTimeoutSet);
+        void setKTls(bool kTls);
 
     private:
         CLI::App* tlsSc = nullptr;
         CLI::Option* initTimeoutOpt = nullptr;
         CLI::Option* shutdownTimeoutOpt = nullptr;
+        CLI::Option* kTlsOpt = nullptr;
 
         utils::Timeval initTimeout;
         utils::Timeval initTimeoutSet = -1;
 
         utils::Timeval shutdownTimeout;
         utils::Timeval shutdownTimeoutSet = -1;
+
+        bool kTls;
+        int kTlsSet = -1;
     };
 
 } // namespace net::config
@@ -27,6 +27,7 @@ namespace net::in::stream::config {
     ConfigSocketClient::ConfigSocketClient() {
         if (!getName().empty()) {
             net::in::config::ConfigAddress<net::config::ConfigAddressRemote>::required();
+            net::config::ConfigConnection::tcpOptions();
         }
     }
 
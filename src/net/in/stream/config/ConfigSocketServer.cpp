@@ -27,6 +27,8 @@ namespace net::in::stream::config {
     ConfigSocketServer::ConfigSocketServer() {
         if (!getName().empty()) {
             net::in::config::ConfigAddress<net::config::ConfigAddressLocal>::portRequired();
+            net::config::ConfigListen::tcpOptions();
+            net::config::ConfigConnection::tcpOptions();
         }
     }
 
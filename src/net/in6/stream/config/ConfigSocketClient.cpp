@@ -27,6 +27,7 @@ namespace net::in6::stream::config {
     ConfigSocketClient::ConfigSocketClient() {
         if (!getName().empty()) {
             net::in6::config::ConfigAddress<net::config::ConfigAddressRemote>::required();
+            net::config::ConfigConnection::tcpOptions();
         }
     }
 
@@ -27,6 +27,8 @@ namespace net::in6::stream::config {
     ConfigSocketServer::ConfigSocketServer() {
         if (!getName().empty()) {
             net::in6::config::ConfigAddress<net::config::ConfigAddressLocal>::portRequired();
+            net::config::ConfigListen::tcpOptions();
+            net::config::ConfigConnection::tcpOptions();
         }
     }
 
@@ -0,0 +1,280 @@
+/*
+ * snode.c - a slim toolkit for network communication
+ * Copyright (C) 2020, 2021, 2022 Volker Christian <me@vchrist.at>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "utils/Cluster.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include "log/Logger.h"
+
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <sys/prctl.h>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+#ifndef CLUSTER_DRAIN_TIMEOUT
+#define CLUSTER_DRAIN_TIMEOUT 15 // exceeds the drain timeout of the workers
+#endif
+
+#ifndef CLUSTER_TERMINATE_TIMEOUT
+#define CLUSTER_TERMINATE_TIMEOUT 5
+#endif
+
+#ifndef CLUSTER_RESTART_LIMIT
+#define CLUSTER_RESTART_LIMIT 5
+#endif
+
+#ifndef CLUSTER_RESTART_WINDOW
+#define CLUSTER_RESTART_WINDOW 60
+#endif
+
+#define CLUSTER_WORKER_ENV "SNODEC_CLUSTER_WORKER"
+#define CLUSTER_PRIMARY_ENV "SNODEC_CLUSTER_PRIMARY"
+
+extern char** environ;
+
+namespace utils {
+
+    bool Cluster::worker = false;
+    std::size_t Cluster::workerIndex = 0;
+    pid_t Cluster::primaryPid = 0;
+    bool Cluster::terminating = false;
+    bool Cluster::draining = false;
+    char** Cluster::argv = nullptr;
+    std::vector<pid_t> Cluster::workers;
+    std::vector<Cluster::Restarts> Cluster::restarts;
+    std::mutex Cluster::workersMutex;
+
+    void Cluster::init(char* argv[]) {
+        Cluster::argv = argv;
+
+        const char* workerEnv = getenv(CLUSTER_WORKER_ENV);
+        const char* primaryEnv = getenv(CLUSTER_PRIMARY_ENV);
+
+        if (workerEnv != nullptr && primaryEnv != nullptr) {
+            worker = true;
+            workerIndex = std::strtoul(workerEnv, nullptr, 10);
+            primaryPid = static_cast<pid_t>(std::strtol(primaryEnv, nullptr, 10));
+
+            // Workers started by a worker would start workers again
+            unsetenv(CLUSTER_WORKER_ENV);
+            unsetenv(CLUSTER_PRIMARY_ENV);
+        }
+    }
+
+    bool Cluster::isWorker() {
+        return worker;
+    }
+
+    std::size_t Cluster::getWorkerIndex() {
+        return workerIndex;
+    }
+
+    pid_t Cluster::getPrimaryPid() {
+        // The primary may have changed its pid by daemonizing after init()
+        return worker ? primaryPid : getpid();
+    }
+
+    std::size_t Cluster::spawnWorkers(std::size_t count) {
+        std::scoped_lock<std::mutex> lock(workersMutex);
+
+        if (count == 0) {
+            count = std::thread::hardware_concurrency();
+        }
+
+        if (!worker && !terminating) {
+            while (workers.size() < count) {
+                restarts.push_back(Restarts{std::chrono::steady_clock::now(), 0, false});
+                workers.push_back(spawnWorker(workers.size()));
+            }
+        }
+
+        return workers.size();
+    }
+
+    void Cluster::reapWorkers() {
+        std::scoped_lock<std::mutex> lock(workersMutex);
+
+        for (std::size_t index = 0; index < workers.size(); index++) {
+            int status = 0;
+
+            if (workers[index] > 0 && waitpid(workers[index], &status, WNOHANG) == workers[index]) {
+                LOG(WARNING) << "Cluster: Worker " << index << " (pid " << workers[index] << ") exited with status " << status;
+
+                workers[index] = terminating ? -1 : respawnWorker(index);
+            } else if (workers[index] < 0 && !terminating) {
+                workers[index] = respawnWorker(index);
+            }
+        }
+    }
+
+    bool Cluster::isWorkerAlive(std::size_t index) {
+        std::scoped_lock<std::mutex> lock(workersMutex);
+
+        return index < workers.size() && workers[index] > 0;
+    }
+
+    void Cluster::drainWorkers() {
+        std::scoped_lock<std::mutex> lock(workersMutex);
+
+        terminating = true;
+        draining = true;
+    }
+
+    void Cluster::terminate() {
+        std::scoped_lock<std::mutex> lock(workersMutex);
+
+        terminating = true;
+
+        // Draining workers close their connections gracefully before SIGTERM would cut them
+        if (draining && !waitForWorkers(std::chrono::steady_clock::now() + std::chrono::seconds(CLUSTER_DRAIN_TIMEOUT))) {
+            LOG(WARNING) << "Cluster: Workers not drained within " << CLUSTER_DRAIN_TIMEOUT << " s: Terminating them";
+        }
+
+        signalWorkers(SIGTERM);
+
+        // Workers stuck in their shutdown or ignoring SIGTERM must not keep the primary from exiting
+        if (!waitForWorkers(std::chrono::steady_clock::now() + std::chrono::seconds(CLUSTER_TERMINATE_TIMEOUT))) {
+            LOG(WARNING) << "Cluster: Workers not terminated within " << CLUSTER_TERMINATE_TIMEOUT << " s: Killing them";
+
+            signalWorkers(SIGKILL);
+            waitForWorkers(std::chrono::steady_clock::time_point::max());
+        }
+    }
+
+    void Cluster::signalWorkers(int sig) {
+        for (const pid_t pid : workers) {
+            if (pid > 0) {
+                kill(pid, sig);
+            }
+        }
+    }
+
+    bool Cluster::waitForWorkers(const std::chrono::steady_clock::time_point& deadline) {
+        bool allExited = false;
+
+        for (;;) {
+            allExited = true;
+
+            for (pid_t& pid : workers) {
+                if (pid > 0) {
+                    int status = 0;
+                    const pid_t ret = waitpid(pid, &status, WNOHANG);
+
+                    if (ret == pid || (ret < 0 && errno == ECHILD)) {
+                        pid = -1;
+                    } else {
+                        allExited = false;
+                    }
+                }
+            }
+
+            if (allExited || std::chrono::steady_clock::now() >= deadline) {
+                break;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+
+        return allExited;
+    }
+
+    pid_t Cluster::respawnWorker(std::size_t index) {
+        pid_t pid = -1;
+
+        Restarts& restart = restarts[index];
+
+        if (!restart.givenUp) {
+            const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+            if (now - restart.since > std::chrono::seconds(CLUSTER_RESTART_WINDOW)) {
+                restart.since = now;
+                restart.count = 0;
+            }
+
+            if (restart.count < CLUSTER_RESTART_LIMIT) {
+                restart.count++;
+                pid = spawnWorker(index);
+            } else {
+                // A worker failing at startup (configuration, bind, exec) would otherwise be forked again on every heartbeat
+                LOG(ERROR) << "Cluster: Worker " << index << " exited " << CLUSTER_RESTART_LIMIT << " times within "
+                           << CLUSTER_RESTART_WINDOW << " s: Not restarted anymore";
+                restart.givenUp = true;
+            }
+        }
+
+        return pid;
+    }
+
+    pid_t Cluster::spawnWorker(std::size_t index) {
+        // Everything the child needs is prepared in advance: only async-signal-safe calls are allowed between fork() and execve()
+        std::vector<std::string> environment;
+        for (char** env = environ; *env != nullptr; env++) {
+            if (std::strncmp(*env, CLUSTER_WORKER_ENV "=", std::strlen(CLUSTER_WORKER_ENV "=")) != 0 &&
+                std::strncmp(*env, CLUSTER_PRIMARY_ENV "=", std::strlen(CLUSTER_PRIMARY_ENV "=")) != 0) {
+                environment.emplace_back(*env);
+            }
+        }
+        environment.push_back(CLUSTER_WORKER_ENV "=" + std::to_string(index));
+        const pid_t parentPid = getpid();
+        environment.push_back(CLUSTER_PRIMARY_ENV "=" + std::to_string(parentPid));
+
+        std::vector<char*> envp;
+        for (std::string& env : environment) {
+            envp.push_back(env.data());
+        }
+        envp.push_back(nullptr);
+
+        sigset_t emptySet;
+        sigemptyset(&emptySet);
+
+        pid_t pid = fork();
+
+        if (pid == 0) {
+            // Workers do not survive their primary
+            prctl(PR_SET_PDEATHSIG, SIGTERM);
+            if (getppid() != parentPid) {
+                _exit(EXIT_FAILURE);
+            }
+
+            sigprocmask(SIG_SETMASK, &emptySet, nullptr);
+
+            // Listening sockets and event loop descriptors of the primary must not leak into the worker
+            close_range(3, ~0U, 0);
+
+            execve("/proc/self/exe", argv, envp.data());
+
+            _exit(EXIT_FAILURE);
+        } else if (pid < 0) {
+            PLOG(ERROR) << "Cluster: Starting worker " << index;
+        } else {
+            VLOG(0) << "Cluster: Worker " << index << " started (pid " << pid << ")";
+        }
+
+        return pid;
+    }
+
+} // namespace utils
@@ -0,0 +1,90 @@
+/*
+ * snode.c - a slim toolkit for network communication
+ * Copyright (C) 2020, 2021, 2022 Volker Christian <me@vchrist.at>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published
+ * by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef UTILS_CLUSTER_H
+#define UTILS_CLUSTER_H
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <sys/types.h>
+#include <vector>
+
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+namespace utils {
+
+    // Process management of a prefork cluster: The primary re-executes the application once per worker. A worker is told its index and
+    // the pid of its primary via the environment and runs the same configuration with all clustered instances as SECONDARY.
+    class Cluster {
+    public:
+        Cluster() = delete;
+        ~Cluster() = delete;
+
+        static void init(char* argv[]);
+
+        static bool isWorker();
+        static std::size_t getWorkerIndex();
+        static pid_t getPrimaryPid();
+
+        // Start workers until count are running (count == 0: one per online cpu). Returns the number of workers
+        static std::size_t spawnWorkers(std::size_t count);
+
+        // Collect exited workers and start replacements. A worker exiting CLUSTER_RESTART_LIMIT times within CLUSTER_RESTART_WINDOW
+        // is not restarted anymore
+        static void reapWorkers();
+
+        static bool isWorkerAlive(std::size_t index);
+
+        // The workers stop accepting and end once their connections are closed. terminate() waits up to CLUSTER_DRAIN_TIMEOUT for them
+        static void drainWorkers();
+
+        // Workers not exited within CLUSTER_TERMINATE_TIMEOUT after SIGTERM are killed
+        static void terminate();
+
+    private:
+        static pid_t spawnWorker(std::size_t index);
+        static pid_t respawnWorker(std::size_t index);
+
+        static void signalWorkers(int sig);
+        // Reaps exited workers until all are gone (true) or deadline has passed (false)
+        static bool waitForWorkers(const std::chrono::steady_clock::time_point& deadline);
+
+        static bool worker;
+        static std::size_t workerIndex;
+        static pid_t primaryPid;
+        static bool terminating;
+        static bool draining;
+        static char** argv;
+
+        struct Restarts {
+            std::chrono::steady_clock::time_point since;
+            int count = 0;
+            bool givenUp = false;
+        };
+
+        static std::vector<pid_t> workers;
+        static std::vector<Restarts> restarts;
+        static std::mutex workersMutex;
+    };
+
+} // namespace utils
+
+#endif // UTILS_CLUSTER_H
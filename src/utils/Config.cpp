@@ -19,6 +19,7 @@
 #include "utils/Config.h"
 
 #include "utils/CLI11.hpp"
+#include "utils/Cluster.h"
 #include "utils/Daemon.h"
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -26,6 +27,7 @@
 #include "log/Logger.h"
 
 #include <cerrno>
+#include <csignal>
 #include <cstdlib>
 #include <fcntl.h>
 #include <filesystem>
@@ -49,6 +51,10 @@
 #define PIDFILEPATH std::string("/etc/snode.c/pid")
 #endif
 
+#ifndef RUNDIRPATH
+#define RUNDIRPATH std::string("/etc/snode.c/run")
+#endif
+
 namespace utils {
 
     int Config::argc = 0;
@@ -60,12 +66,17 @@ namespace utils {
     bool Config::stopDaemon = false;
     bool Config::forceLogFile = false;
     bool Config::showConfig = false;
+    unsigned long Config::busyPoll = 0;
+    unsigned long Config::watchdog = 0;
+    pid_t Config::restartPid = 0;
+    pid_t Config::restartPidArg = 0;
     std::string Config::logFile;
     std::string Config::outputConfigFile;
 
     std::string Config::defaultConfDir;
     std::string Config::defaultLogDir;
     std::string Config::defaultPidDir;
+    std::string Config::defaultRunDir;
 
     int Config::init(int argc, char* argv[]) {
         Config::argc = argc;
@@ -73,6 +84,8 @@ namespace utils {
 
         name = std::filesystem::path(argv[0]).filename();
 
+        Cluster::init(argv);
+
         const char* homedir;
         if ((homedir = getenv("XDG_CONFIG_HOME")) == nullptr) {
             if ((homedir = getenv("HOME")) == nullptr) {
@@ -84,6 +97,9 @@ namespace utils {
         defaultLogDir = homedir + LOGFILEPATH;
         defaultPidDir = homedir + PIDFILEPATH;
 
+        const char* runtimeDir = getenv("XDG_RUNTIME_DIR");
+        defaultRunDir = runtimeDir != nullptr ? std::string(runtimeDir) + "/snode.c" : homedir + RUNDIRPATH;
+
         logger::Logger::init(argc, argv);
         std::filesystem::create_directories(defaultConfDir);
         std::filesystem::permissions(
@@ -99,6 +115,10 @@ namespace utils {
         std::filesystem::permissions(
             defaultPidDir, (std::filesystem::perms::owner_all | std::filesystem::perms::group_all) & ~std::filesystem::perms::others_all);
 
+        // Accessible by the owner only: control sockets placed here accept hand over requests
+        std::filesystem::create_directories(defaultRunDir);
+        std::filesystem::permissions(defaultRunDir, std::filesystem::perms::owner_all);
+
         app.option_defaults()->take_first();
         app.option_defaults()->configurable();
         app.configurable();
@@ -133,10 +153,30 @@ namespace utils {
         CLI::Option* startDaemonOpt = app.add_flag("-d,!-f,--daemonize,!--foreground", startDaemon, "Start application as daemon");
         startDaemonOpt->excludes(showConfigFlag);
 
+        CLI::Option* busyPollOpt =
+            app.add_option("--busy-poll", busyPoll, "Spin for up to this budget after the last event before blocking in the multiplexer");
+        busyPollOpt->type_name("[us]");
+        busyPollOpt->default_val(0);
+        busyPollOpt->excludes(showConfigFlag);
+
+        CLI::Option* watchdogOpt = app.add_option("--watchdog", watchdog, "Report event dispatches blocking the event loop longer than this");
+        watchdogOpt->type_name("[ms]");
+        watchdogOpt->default_val(0);
+        watchdogOpt->excludes(showConfigFlag);
+
         CLI::Option* stopDaemonOpt = app.add_flag("-k,--kill", stopDaemon, "Kill running daemon");
         stopDaemonOpt->disable_flag_override();
         stopDaemonOpt->configurable(false);
 
+        CLI::Option* restartOpt =
+            app.add_option("-r,--restart", restartPidArg, "Take over the listening sockets of the running daemon or of the process pid");
+        restartOpt->expected(0, 1);
+        restartOpt->default_str("0");
+        restartOpt->type_name("[pid]");
+        restartOpt->configurable(false);
+        restartOpt->excludes(stopDaemonOpt);
+        restartOpt->excludes(showConfigFlag);
+
         parse();
 
         if (stopDaemon) {
@@ -151,11 +191,32 @@ namespace utils {
 
             parse(); // for daemonize, logfile and forceLogFile
 
+            if (app["--restart"]->count() > 0 && !Cluster::isWorker()) {
+                // Resolved once here as the pid file is erased below
+                restartPid = restartPidArg;
+                if (restartPid == 0) {
+                    restartPid = utils::Daemon::readPidFile(defaultPidDir + "/" + name + ".pid");
+                }
+
+                if (restartPid <= 0 || kill(restartPid, 0) < 0) {
+                    VLOG(0) << "Restart: No running instance to take over";
+                    restartPid = 0;
+                } else {
+                    VLOG(0) << "Restart: Taking over from pid " << restartPid;
+
+                    // The pid file passes to the new daemon
+                    Daemon::erasePidFile(defaultPidDir + "/" + name + ".pid");
+                }
+            }
+
             if (!showConfig) {
                 if (startDaemon) {
-                    VLOG(0) << "Running as daemon";
+                    // Cluster workers are started by an already daemonized primary which owns the pid file
+                    if (!Cluster::isWorker()) {
+                        VLOG(0) << "Running as daemon";
 
-                    utils::Daemon::startDaemon(defaultPidDir + "/" + name + ".pid");
+                        utils::Daemon::startDaemon(defaultPidDir + "/" + name + ".pid");
+                    }
                     logger::Logger::quiet();
                 } else {
                     if (!forceLogFile) {
@@ -191,7 +252,10 @@ namespace utils {
     }
 
     void Config::terminate() {
-        if (startDaemon) {
+        Cluster::terminate();
+
+        // After a restart the pid file belongs to the new daemon
+        if (startDaemon && !Cluster::isWorker() && Daemon::readPidFile(defaultPidDir + "/" + name + ".pid") == getpid()) {
             Daemon::erasePidFile(defaultPidDir + "/" + name + ".pid");
         }
 
@@ -210,6 +274,22 @@ namespace utils {
         return name;
     }
 
+    unsigned long Config::getBusyPoll() {
+        return busyPoll;
+    }
+
+    unsigned long Config::getWatchdog() {
+        return watchdog;
+    }
+
+    std::string Config::getRunDir() {
+        return defaultRunDir;
+    }
+
+    pid_t Config::getRestartPid() {
+        return restartPid;
+    }
+
     int Config::parse(bool stopOnError) {
         try {
             int errnotmp = errno;
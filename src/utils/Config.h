@@ -26,6 +26,7 @@ namespace CLI {
 } // namespace CLI
 
 #include <string>
+#include <sys/types.h>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
@@ -48,6 +49,18 @@ namespace utils {
 
         static std::string getApplicationName();
 
+        // Microseconds an event loop keeps polling without blocking after its last active event
+        static unsigned long getBusyPoll();
+
+        // Milliseconds a single event dispatch may take before the watchdog reports it. 0 disables the watchdog
+        static unsigned long getWatchdog();
+
+        // Directory accessible by the owner only, e.g. for control sockets. Below $XDG_RUNTIME_DIR if set
+        static std::string getRunDir();
+
+        // Pid of the running instance whose listening sockets are taken over (--restart). 0 if none
+        static pid_t getRestartPid();
+
         static int parse(bool stopOnError = false);
 
     private:
@@ -61,10 +74,15 @@ namespace utils {
         static bool dumpConfig;
         static bool forceLogFile;
         static bool showConfig;
+        static unsigned long busyPoll;
+        static unsigned long watchdog;
+        static pid_t restartPid;
+        static pid_t restartPidArg;
         static std::string logFile;
         static std::string defaultConfDir;
         static std::string defaultLogDir;
         static std::string defaultPidDir;
+        static std::string defaultRunDir;
     };
 
 } // namespace utils
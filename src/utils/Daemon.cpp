@@ -160,4 +160,19 @@ namespace utils {
         (void) std::remove(pidFileName.data());
     }
 
+    pid_t Daemon::readPidFile(const std::string& pidFileName) {
+        pid_t pid = -1;
+
+        std::ifstream pidFile(pidFileName, std::ifstream::in);
+        if (pidFile.good()) {
+            pidFile >> pid;
+
+            if (pidFile.fail()) {
+                pid = -1;
+            }
+        }
+
+        return pid;
+    }
+
 } // namespace utils
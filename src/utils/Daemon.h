@@ -22,6 +22,7 @@
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
 #include <string>
+#include <sys/types.h>
 
 #endif // DOXYGEN_SHOULD_SKIP_THIS
 
@@ -36,6 +37,9 @@ namespace utils {
         static void stopDaemon(const std::string& pidFileName);
 
         static void erasePidFile(const std::string& pidFileName);
+
+        // Pid stored in pidFileName or -1 if it can not be read
+        static pid_t readPidFile(const std::string& pidFileName);
     };
 
 } // namespace utils
@@ -59,8 +59,10 @@ namespace utils {
     }
 
     Timeval Timeval::currentTime() {
-        utils::Timeval currentTime;
-        core::system::gettimeofday(&currentTime, nullptr);
+        timespec now = {0, 0};
+        core::system::clock_gettime(CLOCK_MONOTONIC, &now);
+
+        utils::Timeval currentTime({now.tv_sec, now.tv_nsec / 1000});
 
         return currentTime;
     }
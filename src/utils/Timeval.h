@@ -39,6 +39,7 @@ namespace utils {
         Timeval(double time);            // cppcheck-suppress noExplicitConstructor
         Timeval(const timeval& timeVal); // cppcheck-suppress noExplicitConstructor
 
+        // Monotonic clock: for deadlines and durations only, it is unaffected by wall clock steps but is no calendar date
         static Timeval currentTime();
 
         Timeval& operator=(const Timeval& timeVal);
@@ -23,7 +23,10 @@
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
+#include <algorithm>
 #include <cctype>
+#include <iterator>
+#include <span>
 #include <tuple>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
@@ -75,79 +78,80 @@ namespace web::http {
     }
 
     std::size_t Parser::readStartLine() {
-        std::size_t consumed = 0;
-        std::size_t ret = 0;
-
-        do {
-            char ch = 0;
-            ret = socketContext->readFromPeer(&ch, 1);
-
-            if (ret > 0) {
-                consumed += ret;
-                if (ch == '\r' || ch == '\n') {
-                    if (ch == '\n') {
-                        parserState = parseStartLine(line);
-                        line.clear();
-                    }
-                } else {
-                    line += ch;
-                }
+        std::span<const char> junk = socketContext->peekFromPeer();
+        std::size_t scanned = 0;
+
+        while (scanned < junk.size() && parserState == ParserState::FIRSTLINE) {
+            std::span<const char> unscanned = junk.subspan(scanned);
+            std::span<const char>::iterator eol = std::find(unscanned.begin(), unscanned.end(), '\n');
+
+            std::copy_if(unscanned.begin(), eol, std::back_inserter(line), [](char ch) -> bool {
+                return ch != '\r';
+            });
+            scanned += static_cast<std::size_t>(eol - unscanned.begin());
+
+            if (eol != unscanned.end()) {
+                scanned++;
+                parserState = parseStartLine(line);
+                line.clear();
             }
-        } while (ret > 0 && parserState == ParserState::FIRSTLINE);
+        }
 
-        return consumed;
+        return socketContext->consumeFromPeer(scanned);
     }
 
     std::size_t Parser::readHeaderLine() {
-        std::size_t consumed = 0;
-        std::size_t ret = 0;
+        std::span<const char> junk = socketContext->peekFromPeer();
+        std::size_t scanned = 0;
 
-        do {
-            char ch = 0;
-            ret = socketContext->readFromPeer(&ch, 1);
-
-            if (ret > 0) {
-                if (ch == '\r' || ch == '\n') {
-                    consumed++;
-                    if (ch == '\n') {
-                        if (EOL) {
-                            splitHeaderLine(line);
-                            line.clear();
-                            if (parserState != ParserState::ERROR) {
-                                parserState = parseHeader();
-                            }
-                            EOL = false;
-                        } else if (line.empty()) {
-                            if (parserState != ParserState::ERROR) {
-                                parserState = parseHeader();
-                            }
-                        } else {
-                            EOL = true;
+        while (scanned < junk.size() && parserState == ParserState::HEADER) {
+            char ch = junk[scanned];
+
+            if (ch == '\r' || ch == '\n') {
+                scanned++;
+                if (ch == '\n') {
+                    if (EOL) {
+                        splitHeaderLine(line);
+                        line.clear();
+                        if (parserState != ParserState::ERROR) {
+                            parserState = parseHeader();
                         }
-                    }
-                } else if (EOL) {
-                    if (std::isblank(ch)) {
-                        if ((hTTPCompliance & HTTPCompliance::RFC7230) == HTTPCompliance::RFC7230) {
-                            parserState = parsingError(400, "Header Folding");
-                        } else {
-                            line += ch;
-                            consumed++;
+                        EOL = false;
+                    } else if (line.empty()) {
+                        if (parserState != ParserState::ERROR) {
+                            parserState = parseHeader();
                         }
                     } else {
-                        splitHeaderLine(line);
-                        line.clear();
+                        EOL = true;
+                    }
+                }
+            } else if (EOL) {
+                if (std::isblank(ch)) {
+                    if ((hTTPCompliance & HTTPCompliance::RFC7230) == HTTPCompliance::RFC7230) {
+                        parserState = parsingError(400, "Header Folding");
+                    } else {
                         line += ch;
-                        consumed++;
+                        scanned++;
                     }
-                    EOL = false;
                 } else {
+                    splitHeaderLine(line);
+                    line.clear();
                     line += ch;
-                    consumed++;
+                    scanned++;
                 }
+                EOL = false;
+            } else {
+                std::span<const char> unscanned = junk.subspan(scanned);
+                std::span<const char>::iterator eol = std::find_if(unscanned.begin(), unscanned.end(), [](char ch) -> bool {
+                    return ch == '\r' || ch == '\n';
+                });
+
+                line.append(unscanned.begin(), eol);
+                scanned += static_cast<std::size_t>(eol - unscanned.begin());
             }
-        } while (ret > 0 && parserState == ParserState::HEADER);
+        }
 
-        return consumed;
+        return socketContext->consumeFromPeer(scanned);
     }
 
     void Parser::splitHeaderLine(const std::string& line) {
@@ -178,36 +182,29 @@ namespace web::http {
     }
 
     std::size_t Parser::readContent() {
-        static char contentJunk[MAX_CONTENT_JUNK_LEN];
+        std::span<const char> junk = socketContext->peekFromPeer();
 
         std::size_t consumed = 0;
 
         if (httpMinor == 0 && contentLength == 0) {
-            consumed = socketContext->readFromPeer(contentJunk, MAX_CONTENT_JUNK_LEN);
+            if (!junk.empty()) {
+                content.insert(content.end(), junk.begin(), junk.end());
 
-            std::size_t contentJunkLen = static_cast<std::size_t>(consumed);
-            if (contentJunkLen > 0) {
-                content.insert(content.end(), contentJunk, contentJunk + contentJunkLen);
+                consumed = socketContext->consumeFromPeer(junk.size());
             } else {
                 parserState = parseContent(content);
             }
         } else if (httpMinor == 1) {
-            std::size_t contentJunkLenLeft =
-                (contentLength - contentRead < MAX_CONTENT_JUNK_LEN) ? contentLength - contentRead : MAX_CONTENT_JUNK_LEN;
+            junk = junk.first(std::min(junk.size(), contentLength - contentRead));
 
-            consumed = socketContext->readFromPeer(contentJunk, contentJunkLenLeft);
+            if (!junk.empty()) {
+                content.insert(content.end(), junk.begin(), junk.end());
+                contentRead += junk.size();
 
-            std::size_t contentJunkLen = static_cast<std::size_t>(consumed);
-            if (contentJunkLen > 0) {
-                if (contentRead + contentJunkLen <= contentLength) {
-                    content.insert(content.end(), contentJunk, contentJunk + contentJunkLen);
+                consumed = socketContext->consumeFromPeer(junk.size());
 
-                    contentRead += contentJunkLen;
-                    if (contentRead == contentLength) {
-                        parserState = parseContent(content);
-                    }
-                } else {
-                    parserState = parsingError(400, "Content to long");
+                if (contentRead == contentLength) {
+                    parserState = parseContent(content);
                 }
             }
         }
@@ -22,6 +22,8 @@
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
+#include <utility>
+
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
 namespace web::http::server {
@@ -48,6 +50,16 @@ namespace web::http::server {
         }
     }
 
+    void RequestContextBase::sendToPeer(std::string&& data) {
+        if (socketContext != nullptr) {
+            socketContext->sendToPeer(std::move(data));
+        }
+    }
+
+    bool RequestContextBase::sendFileToPeer(int fd, off_t offset, std::size_t count) {
+        return socketContext != nullptr && socketContext->sendFileToPeer(fd, offset, count);
+    }
+
     void RequestContextBase::sendToPeerCompleted() {
         if (socketContext != nullptr) {
             socketContext->sendToPeerCompleted();
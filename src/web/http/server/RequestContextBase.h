@@ -32,6 +32,8 @@ namespace core::socket {
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
 #include <cstddef>
+#include <string>
+#include <sys/types.h>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
@@ -48,6 +50,8 @@ namespace web::http::server {
         void switchSocketContext(core::socket::SocketContextFactory* socketContextUpgradeFactory);
 
         void sendToPeer(const char* junk, std::size_t junkLen);
+        void sendToPeer(std::string&& data);
+        bool sendFileToPeer(int fd, off_t offset, std::size_t count);
         void sendToPeerCompleted();
         void close();
 
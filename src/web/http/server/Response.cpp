@@ -29,11 +29,13 @@
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
 #include "core/system/time.h"
+#include "core/system/unistd.h"
 #include "log/Logger.h"
 
 #include <cerrno>
 #include <filesystem>
 #include <numeric>
+#include <sys/stat.h>
 #include <system_error>
 #include <utility>
 
@@ -46,16 +48,39 @@ namespace web::http::server {
     }
 
     void Response::enqueue(const char* junk, std::size_t junkLen) {
+        startEnqueue();
+
+        // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDelete)
+        requestContext->sendToPeer(junk, junkLen);
+
+        finishEnqueue(junkLen);
+    }
+
+    void Response::enqueue(const std::string& junk) {
+        enqueue(junk.data(), junk.size());
+    }
+
+    void Response::enqueue(std::string&& junk) {
+        std::size_t junkLen = junk.size();
+
+        startEnqueue();
+
+        // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDelete)
+        requestContext->sendToPeer(std::move(junk));
+
+        finishEnqueue(junkLen);
+    }
+
+    void Response::startEnqueue() {
         if (!headersSent && !sendHeaderInProgress) {
             sendHeaderInProgress = true;
             sendHeader();
             sendHeaderInProgress = false;
             headersSent = true;
         }
+    }
 
-        // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDelete)
-        requestContext->sendToPeer(junk, junkLen);
-
+    void Response::finishEnqueue(std::size_t junkLen) {
         if (headersSent) {
             contentSent += junkLen;
             if (contentSent == contentLength) {
@@ -66,10 +91,6 @@ namespace web::http::server {
         }
     }
 
-    void Response::enqueue(const std::string& junk) {
-        enqueue(junk.data(), junk.size());
-    }
-
     void Response::send(const char* junk, std::size_t junkLen) {
         if (junkLen > 0) {
             set("Content-Type", "application/octet-stream", false);
@@ -86,6 +107,15 @@ namespace web::http::server {
         send(junk.data(), junk.size());
     }
 
+    void Response::send(std::string&& junk) {
+        if (junk.size() > 0) {
+            set("Content-Type", "text/html; charset=utf-8", false);
+        }
+        set("Content-Length", std::to_string(junk.size()), false);
+
+        enqueue(std::move(junk));
+    }
+
     void Response::end() {
         send("");
     }
@@ -183,15 +213,39 @@ namespace web::http::server {
             absolutFileName = std::filesystem::canonical(absolutFileName);
 
             if (std::filesystem::is_regular_file(absolutFileName, ec) && !ec) {
-                core::file::FileReader::connect(absolutFileName, *this, [this, &absolutFileName, onError](int err) -> void {
-                    if (err == 0) {
-                        headers.insert({{"Content-Type", web::http::MimeTypes::contentType(absolutFileName)},
-                                        {"Last-Modified", httputils::file_mod_http_date(absolutFileName)}});
-                        headers.insert_or_assign("Content-Length", std::to_string(std::filesystem::file_size(absolutFileName)));
+                int fd = core::system::open(absolutFileName.c_str(), O_RDONLY);
+
+                // Size of the file actually opened: it may have been replaced or removed meanwhile
+                struct stat fileStat {};
+                if (fd >= 0 && fstat(fd, &fileStat) < 0) {
+                    const int fstatErrno = errno;
+                    core::system::close(fd);
+                    fd = -1;
+                    errno = fstatErrno;
+                }
+
+                if (fd >= 0) {
+                    std::size_t fileSize = static_cast<std::size_t>(fileStat.st_size);
+
+                    headers.insert({{"Content-Type", web::http::MimeTypes::contentType(absolutFileName)},
+                                    {"Last-Modified", httputils::file_mod_http_date(absolutFileName)}});
+                    headers.insert_or_assign("Content-Length", std::to_string(fileSize));
+
+                    startEnqueue();
+
+                    // Legacy connections let the kernel send the file (sendfile). Otherwise it is piped through a FileReader
+                    if (requestContext->sendFileToPeer(fd, 0, fileSize)) {
+                        finishEnqueue(fileSize);
+                    } else if (fileSize > 0) {
+                        // The headers are sent already: the file must not be opened again as that could fail now
+                        core::file::FileReader::connect(fd, *this, "FileReader: " + absolutFileName);
                     } else {
-                        onError(err);
+                        core::system::close(fd);
+                        finishEnqueue(0);
                     }
-                });
+                } else {
+                    onError(errno);
+                }
             } else {
                 errno = EEXIST;
                 onError(errno);
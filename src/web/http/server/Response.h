@@ -49,6 +49,7 @@ namespace web::http::server {
     public:
         void send(const char* junk, std::size_t junkLen);
         void send(const std::string& junk);
+        void send(std::string&& junk);
 
         void end();
 
@@ -83,6 +84,9 @@ namespace web::http::server {
 
         void enqueue(const char* junk, std::size_t junkLen);
         void enqueue(const std::string& junk);
+        void enqueue(std::string&& junk);
+        void startEnqueue();
+        void finishEnqueue(std::size_t junkLen);
         void sendHeader();
 
         void receive(const char* junk, std::size_t junkLen) override;
@@ -84,6 +84,9 @@ namespace web::http::server {
         void onConnected() override;
         void onDisconnected() override;
 
+        void onWriteBufferFull() override;
+        void onWriteBufferDrained() override;
+
         void requestParsed();
 
         void reset();
@@ -122,6 +122,7 @@ namespace web::http::server {
         }
 
         if (currentRequestContext) {
+            currentRequestContext->response.disconnect(); // releases a possibly suspended source
             currentRequestContext->socketContextGone();
         }
     }
@@ -201,4 +202,18 @@ namespace web::http::server {
         VLOG(0) << "HTTP disconnected";
     }
 
+    template <typename Request, typename Response>
+    void SocketContext<Request, Response>::onWriteBufferFull() {
+        if (currentRequestContext != nullptr) {
+            currentRequestContext->response.suspendSource();
+        }
+    }
+
+    template <typename Request, typename Response>
+    void SocketContext<Request, Response>::onWriteBufferDrained() {
+        if (currentRequestContext != nullptr) {
+            currentRequestContext->response.resumeSource();
+        }
+    }
+
 } // namespace web::http::server
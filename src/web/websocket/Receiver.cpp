@@ -22,9 +22,11 @@
 
 #include "log/Logger.h"
 
+#include <algorithm>
 #include <endian.h>
 #include <iomanip>
 #include <memory>
+#include <span>
 #include <sstream>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
@@ -191,24 +193,29 @@ namespace web::websocket {
     }
 
     std::size_t Receiver::readPayload() {
-        std::size_t payloadJunkLeft = (MAX_PAYLOAD_JUNK_LEN <= payLoadNumBytesLeft) ? static_cast<std::size_t>(MAX_PAYLOAD_JUNK_LEN)
-                                                                                    : static_cast<std::size_t>(payLoadNumBytesLeft);
+        std::span<const char> junk = peekFrameData();
+        junk = junk.first(static_cast<std::size_t>(std::min(static_cast<uint64_t>(junk.size()), payLoadNumBytesLeft)));
 
-        std::size_t ret = readFrameData(payloadJunk, payloadJunkLeft);
-
-        if (ret > 0) {
-            std::size_t payloadJunkLen = static_cast<std::size_t>(ret);
+        std::size_t ret = 0;
 
+        if (!junk.empty()) {
             if (masked) {
-                for (std::size_t i = 0; i < payloadJunkLen; i++) {
-                    *(payloadJunk + i) =
-                        *(payloadJunk + i) ^ *(maskingKeyAsArray.keyAsArray + (i + (payLoadNumBytes - payLoadNumBytesLeft)) % 4);
+                // Unmasking is the copy out of the read buffer
+                junk = junk.first(std::min(junk.size(), static_cast<std::size_t>(MAX_PAYLOAD_JUNK_LEN)));
+
+                for (std::size_t i = 0; i < junk.size(); i++) {
+                    *(payloadJunk + i) = junk[i] ^ *(maskingKeyAsArray.keyAsArray + (i + (payLoadNumBytes - payLoadNumBytesLeft)) % 4);
                 }
-            }
 
-            onMessageData(payloadJunk, payloadJunkLen);
+                ret = consumeFrameData(junk.size());
+                onMessageData(payloadJunk, ret);
+            } else {
+                // Unmasked payload is delivered in place
+                ret = consumeFrameData(junk.size());
+                onMessageData(junk.data(), ret);
+            }
 
-            payLoadNumBytesLeft -= payloadJunkLen;
+            payLoadNumBytesLeft -= ret;
         }
 
         if (payLoadNumBytesLeft == 0) {
@@ -23,6 +23,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <span>
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
@@ -61,6 +62,8 @@ namespace web::websocket {
         virtual void onMessageError(uint16_t errnum) = 0;
 
         virtual std::size_t readFrameData(char* junk, std::size_t junkLen) = 0;
+        virtual std::span<const char> peekFrameData() = 0;
+        virtual std::size_t consumeFrameData(std::size_t junkLen) = 0;
 
         void reset();
 
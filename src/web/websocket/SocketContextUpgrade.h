@@ -60,6 +60,8 @@ namespace web::websocket {
         using Response = ResponseT;
 
     private:
+        using Super::consumeFromPeer;
+        using Super::peekFromPeer;
         using Super::readFromPeer;
         using Super::sendToPeer;
         using Super::setTimeout;
@@ -206,6 +208,14 @@ namespace web::websocket {
             return readFromPeer(junk, junkLen);
         }
 
+        std::span<const char> peekFrameData() override {
+            return peekFromPeer();
+        }
+
+        std::size_t consumeFrameData(std::size_t junkLen) override {
+            return consumeFromPeer(junkLen);
+        }
+
         /* Callbacks (API) socketConnection -> WSProtocol */
         void onConnected() override {
             VLOG(0) << "Websocket connected";